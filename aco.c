@@ -0,0 +1,284 @@
+#include "aco.h"
+#include <math.h>
+
+typedef struct {
+    const KnapsackInstance *instance;
+    const double *desirability; // tau^alpha × eta^beta, figé pendant l'itération
+    const int *lightest;        // Objets par poids croissant, une ligne de n par contrainte
+    KnapsackSolution **ants;
+    double *trees;              // Arbres de Fenwick des désirabilités, une ligne de n + 1 par fourmi
+    char *remaining;            // Candidats restants, une ligne de n par fourmi
+    int *loads;                 // Charges, une ligne de m par fourmi
+    int *cursors;               // Premier objet restant de chaque ligne de `lightest`, une ligne de m par fourmi
+    int tree_step;              // Plus grande puissance de 2 inférieure ou égale à n
+    unsigned long long seed;
+    long long first_task;       // Rang global de la première fourmi de l'itération
+} AntBatch;
+
+// Ligne de poids de référence pour qsort (propre à chaque thread)
+static _Thread_local const int *aco_weights = NULL;
+
+// Poids croissant, puis indice croissant (tri déterministe)
+static int compare_weights(const void *a, const void *b)
+{
+    int wa = aco_weights[*(const int *)a];
+    int wb = aco_weights[*(const int *)b];
+    if (wa != wb)
+    {
+        return (wa > wb) - (wa < wb);
+    }
+    return *(const int *)a - *(const int *)b;
+}
+
+AcoConfig default_aco_config(void)
+{
+    AcoConfig config;
+    config.ants = 20;
+    config.alpha = 1.0;
+    config.beta = 2.0;
+    config.evaporation = 0.05;
+    config.tau_min = 0.01;
+    config.global_best_period = 10;
+    config.restart_iterations = 250;
+    config.iterations = 100000;
+    config.seed = 1;
+    config.pool = NULL;
+    return config;
+}
+
+// Construction d'une solution par une fourmi
+static void build_ant(void *arg, int index)
+{
+    AntBatch *batch = (AntBatch *)arg;
+    const KnapsackInstance *instance = batch->instance;
+    int n = instance->n;
+    int m = instance->m;
+    KnapsackSolution *ant = batch->ants[index];
+    double *tree = &batch->trees[(size_t)index * (n + 1)];
+    char *remaining = &batch->remaining[(size_t)index * n];
+    int *load = &batch->loads[(size_t)index * m];
+    int *cursor = &batch->cursors[(size_t)index * m];
+    RngState rng;
+    rng_seed(&rng, rng_derive(batch->seed, batch->first_task + index));
+
+    // Arbre de Fenwick construit en O(n) : tree[j] couvre les (j & -j) objets finissant en j - 1
+    tree[0] = 0.0;
+    for (int i = 0; i < n; i++)
+    {
+        ant->x[i] = 0;
+        remaining[i] = 1;
+        tree[i + 1] = batch->desirability[i];
+    }
+    for (int j = 1; j <= n; j++)
+    {
+        int parent = j + (j & -j);
+        if (parent <= n)
+        {
+            tree[parent] += tree[j];
+        }
+    }
+    double total = 0.0;
+    for (int j = n; j > 0; j -= j & -j)
+    {
+        total += tree[j];
+    }
+    for (int k = 0; k < m; k++)
+    {
+        load[k] = 0;
+        cursor[k] = 0;
+    }
+    ant->Z = 0;
+
+    for (int count = n; count > 0; count--)
+    {
+        // Tirage par roulette : descente dans l'arbre vers le premier préfixe qui dépasse la cible
+        double target = rng_double(&rng) * total;
+        int i = 0;
+        for (int step = batch->tree_step; step > 0; step >>= 1)
+        {
+            if (i + step <= n && tree[i + step] <= target)
+            {
+                i += step;
+                target -= tree[i];
+            }
+        }
+        if (i >= n || !remaining[i])
+        {
+            // Arrondis (ou désirabilités restantes nulles) : premier objet restant
+            while (!remaining[batch->lightest[cursor[0]]])
+            {
+                cursor[0]++;
+            }
+            i = batch->lightest[cursor[0]];
+        }
+
+        remaining[i] = 0;
+        for (int j = i + 1; j <= n; j += j & -j)
+        {
+            tree[j] -= batch->desirability[i];
+        }
+        total = count > 1 ? fmax(total - batch->desirability[i], 0.0) : 0.0;
+        int fits = 1;
+        for (int k = 0; k < m && fits; k++)
+        {
+            fits = load[k] + instance->weights[k][i] <= instance->capacities[k];
+        }
+        if (fits)
+        {
+            ant->x[i] = 1;
+            ant->Z += instance->profits[i];
+            for (int k = 0; k < m; k++)
+            {
+                load[k] += instance->weights[k][i];
+            }
+            continue;
+        }
+
+        // Après un rejet : arrêt dès qu'une contrainte n'a plus la place de son objet restant le plus léger
+        int open = count > 1;
+        for (int k = 0; k < m && open; k++)
+        {
+            const int *lightest = &batch->lightest[(size_t)k * n];
+            while (!remaining[lightest[cursor[k]]])
+            {
+                cursor[k]++;
+            }
+            open = load[k] + instance->weights[k][lightest[cursor[k]]] <= instance->capacities[k];
+        }
+        if (!open)
+        {
+            break;
+        }
+    }
+}
+
+KnapsackSolution *aco_search(const KnapsackInstance *instance, const AcoConfig *config, double time_limit)
+{
+    TimeValue start = get_current_time();
+    int n = instance->n;
+    int ants = config->ants;
+
+    double *pheromone = (double *)malloc(n * sizeof(double));
+    double *heuristic = (double *)malloc(n * sizeof(double));
+    double *desirability = (double *)malloc(n * sizeof(double));
+    int *lightest = (int *)malloc((size_t)instance->m * n * sizeof(int));
+    double *trees = (double *)malloc((size_t)ants * (n + 1) * sizeof(double));
+    char *remaining = (char *)malloc((size_t)ants * n);
+    int *loads = (int *)malloc((size_t)ants * instance->m * sizeof(int));
+    int *cursors = (int *)malloc((size_t)ants * instance->m * sizeof(int));
+    KnapsackSolution **colony = (KnapsackSolution **)calloc(ants, sizeof(KnapsackSolution *));
+    KnapsackSolution *best = NULL;
+    if (!pheromone || !heuristic || !desirability || !lightest || !trees || !remaining || !loads || !cursors || !colony)
+    {
+        perror("Erreur d'allocation mémoire (aco_search)");
+        goto cleanup;
+    }
+    for (int a = 0; a < ants; a++)
+    {
+        colony[a] = init_solution(n);
+    }
+
+    // Heuristique normalisée par le meilleur ratio, phéromone au maximum
+    double max_ratio = 0.0;
+    for (int i = 0; i < n; i++)
+    {
+        heuristic[i] = efficiency_ratio(instance, i);
+        if (heuristic[i] > max_ratio)
+        {
+            max_ratio = heuristic[i];
+        }
+    }
+    for (int i = 0; i < n; i++)
+    {
+        heuristic[i] = max_ratio > 0 ? pow(heuristic[i] / max_ratio, config->beta) : 1.0;
+        pheromone[i] = 1.0;
+    }
+    best = init_solution(n);
+
+    // Objets par poids croissant sur chaque contrainte, pour l'arrêt des fourmis
+    for (int k = 0; k < instance->m; k++)
+    {
+        int *row = &lightest[(size_t)k * n];
+        for (int i = 0; i < n; i++)
+        {
+            row[i] = i;
+        }
+        aco_weights = instance->weights[k];
+        qsort(row, n, sizeof(int), compare_weights);
+    }
+    aco_weights = NULL;
+    int tree_step = 1;
+    while (tree_step * 2 <= n)
+    {
+        tree_step *= 2;
+    }
+
+    AntBatch batch = {instance, desirability, lightest, colony, trees, remaining, loads, cursors, tree_step, config->seed, 0};
+    int stagnation = 0;
+    for (int it = 0; it < config->iterations && !time_exceeded(start, time_limit) && !target_reached(best->Z); it++)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            desirability[i] = pow(pheromone[i], config->alpha) * heuristic[i];
+        }
+
+        // Les fourmis ne lisent que la phéromone figée : construction en parallèle
+        batch.first_task = (long long)it * ants;
+        thread_pool_parallel_for(config->pool, ants, build_ant, &batch);
+
+        // Mise à jour synchronisée, une fois toutes les fourmis terminées
+        int iteration_best = 0;
+        for (int a = 1; a < ants; a++)
+        {
+            if (colony[a]->Z > colony[iteration_best]->Z)
+            {
+                iteration_best = a;
+            }
+        }
+        stagnation++;
+        if (colony[iteration_best]->Z > best->Z)
+        {
+            copy_solution_into(best, colony[iteration_best], n);
+            stagnation = 0;
+        }
+
+        if (config->restart_iterations > 0 && stagnation >= config->restart_iterations)
+        {
+            for (int i = 0; i < n; i++)
+            {
+                pheromone[i] = 1.0;
+            }
+            stagnation = 0;
+            continue;
+        }
+
+        const int *deposit = (config->global_best_period > 0 && (it + 1) % config->global_best_period == 0) ? best->x : colony[iteration_best]->x;
+        for (int i = 0; i < n; i++)
+        {
+            double tau = (1.0 - config->evaporation) * pheromone[i] + config->evaporation * deposit[i];
+            pheromone[i] = tau < config->tau_min ? config->tau_min : (tau > 1.0 ? 1.0 : tau);
+        }
+    }
+
+cleanup:
+    if (colony)
+    {
+        for (int a = 0; a < ants; a++)
+        {
+            if (colony[a])
+            {
+                free_solution(colony[a]);
+            }
+        }
+    }
+    free(colony);
+    free(pheromone);
+    free(heuristic);
+    free(desirability);
+    free(lightest);
+    free(trees);
+    free(remaining);
+    free(loads);
+    free(cursors);
+    return best;
+}
@@ -0,0 +1,59 @@
+#ifndef ACO_H
+#define ACO_H
+
+#include "heuristique.h"
+#include "thread_pool.h"
+
+/**
+ * @brief Paramètres du système de fourmis MAX-MIN (MMAS).
+ *
+ * La phéromone est portée par les objets. Une fourmi part du sac vide et ajoute des objets
+ * tirés proportionnellement à tau[i]^alpha × eta[i]^beta, où eta est le ratio d'efficacité
+ * du glouton (`efficiency_ratio`). Les désirabilités des candidats sont tenues dans un arbre
+ * de Fenwick : tirage et retrait coûtent O(log n). Un objet tiré qui ne tient plus est retiré
+ * des candidats (test en O(m) sur les charges de la fourmi) : les charges ne faisant que
+ * croître, il ne tiendra plus jamais. La fourmi s'arrête dès que, sur une contrainte, même
+ * le plus léger des candidats restants dépasse la capacité résiduelle.
+ *
+ * Après chaque itération, la phéromone s'évapore au taux `evaporation` et la meilleure
+ * fourmi de l'itération (ou, une itération sur `global_best_period`, la meilleure solution
+ * connue) dépose sur ses objets ; les traces restent dans [tau_min, 1]. Sans amélioration
+ * pendant `restart_iterations` itérations, la phéromone est réinitialisée.
+ */
+typedef struct {
+    int ants;               ///< Nombre de fourmis par itération.
+    double alpha;           ///< Poids de la phéromone.
+    double beta;            ///< Poids de l'heuristique.
+    double evaporation;     ///< Taux d'évaporation (rho).
+    double tau_min;         ///< Borne inférieure des traces (la borne supérieure vaut 1).
+    int global_best_period; ///< Période de dépôt par la meilleure solution connue (0 : jamais).
+    int restart_iterations; ///< Itérations sans amélioration avant réinitialisation (0 : jamais).
+    int iterations;         ///< Nombre maximal d'itérations.
+    unsigned long long seed; ///< Graine des fourmis.
+    ThreadPool *pool;       ///< Pool pour faire construire les fourmis en parallèle (`NULL` : séquentiel).
+} AcoConfig;
+
+/**
+ * @brief Retourne la configuration par défaut (20 fourmis, alpha 1, beta 2, rho 0.05).
+ *
+ * @return La configuration par défaut.
+ */
+AcoConfig default_aco_config(void);
+
+/**
+ * @brief Exécute MMAS jusqu'au nombre d'itérations ou à l'échéance.
+ *
+ * Les fourmis d'une itération ne lisent que la phéromone, figée pendant leur construction,
+ * et ont chacune un générateur dérivé de la graine et de leur rang : elles sont réparties
+ * sur le pool, puis la mise à jour de la phéromone est faite par le thread appelant une
+ * fois toutes les fourmis terminées. Le résultat ne dépend pas du nombre de threads (sauf
+ * arrêt sur échéance).
+ *
+ * @param instance Instance du problème.
+ * @param config Paramètres de l'algorithme.
+ * @param time_limit Durée maximale en secondes (0 pour illimité), vérifiée entre deux itérations.
+ * @return La meilleure solution trouvée (à libérer avec `free_solution`), ou `NULL` en cas d'erreur.
+ */
+KnapsackSolution *aco_search(const KnapsackInstance *instance, const AcoConfig *config, double time_limit);
+
+#endif // ACO_H
@@ -0,0 +1,446 @@
+#include "alns.h"
+#include "surrogate.h"
+#include <string.h>
+#include <math.h>
+
+// Scores de Ropke et Pisinger : nouvelle meilleure, amélioration, dégradation acceptée
+#define ALNS_SCORE_BEST 33.0
+#define ALNS_SCORE_IMPROVED 9.0
+#define ALNS_SCORE_ACCEPTED 13.0
+#define ALNS_MIN_WEIGHT 0.05
+#define ALNS_TOURNAMENT 3
+#define ALNS_RANDOM_SKIP 0.3
+#define ALNS_REHEAT 0.01
+
+static const char *destroy_names[ALNS_DESTROY_COUNT] = {"Aléatoire", "Moins efficaces", "Contrainte la plus chargée", "Historique"};
+static const char *repair_names[ALNS_REPAIR_COUNT] = {"Gloutonne", "Duale (surrogate)", "Aléatoire"};
+
+// Solution courante avec charges et liste des objets sélectionnés tenues à jour
+typedef struct {
+    const KnapsackInstance *instance;
+    int *x;
+    int Z;
+    int *load;
+    int *selected;  // Objets sélectionnés (count premiers)
+    int *position;  // Place de chaque objet dans selected (-1 s'il n'est pas sélectionné)
+    int count;
+    int *blocked;   // blocked[i] == stamp : objet retiré à cette itération
+    int stamp;
+    int *moves;     // Objets inversés à cette itération, pour l'annulation
+    int move_count;
+} AlnsState;
+
+// Inverse l'objet i en O(m)
+static void flip(AlnsState *state, int i)
+{
+    const KnapsackInstance *instance = state->instance;
+    int sign = state->x[i] ? -1 : 1;
+    state->x[i] = 1 - state->x[i];
+    state->Z += sign * instance->profits[i];
+    for (int k = 0; k < instance->m; k++)
+    {
+        state->load[k] += sign * instance->weights[k][i];
+    }
+    if (sign > 0)
+    {
+        state->position[i] = state->count;
+        state->selected[state->count++] = i;
+    }
+    else
+    {
+        int last = state->selected[--state->count];
+        state->selected[state->position[i]] = last;
+        state->position[last] = state->position[i];
+        state->position[i] = -1;
+    }
+}
+
+static void apply(AlnsState *state, int i)
+{
+    flip(state, i);
+    state->moves[state->move_count++] = i;
+}
+
+// Annule les mouvements de l'itération dans l'ordre inverse
+static void undo(AlnsState *state)
+{
+    while (state->move_count > 0)
+    {
+        flip(state, state->moves[--state->move_count]);
+    }
+}
+
+static int fits(const AlnsState *state, int i)
+{
+    const KnapsackInstance *instance = state->instance;
+    for (int k = 0; k < instance->m; k++)
+    {
+        if (state->load[k] + instance->weights[k][i] > instance->capacities[k])
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void remove_item(AlnsState *state, int i)
+{
+    apply(state, i);
+    state->blocked[i] = state->stamp;
+}
+
+// Tournoi : parmi quelques objets sélectionnés tirés au hasard, celui de plus petite clé
+static int tournament(const AlnsState *state, RngState *rng, const double *key)
+{
+    int chosen = state->selected[rng_int(rng, state->count)];
+    for (int t = 1; t < ALNS_TOURNAMENT; t++)
+    {
+        int i = state->selected[rng_int(rng, state->count)];
+        if (key[i] < key[chosen])
+        {
+            chosen = i;
+        }
+    }
+    return chosen;
+}
+
+static void destroy(AlnsState *state, AlnsDestroy op, int q, RngState *rng, const double *efficiency, double *scratch, const int *history)
+{
+    const KnapsackInstance *instance = state->instance;
+    if (op == ALNS_DESTROY_CONSTRAINT)
+    {
+        // Contrainte la plus chargée, relativement à sa capacité (O(m))
+        int tight = 0;
+        for (int k = 1; k < instance->m; k++)
+        {
+            if ((double)state->load[k] * instance->capacities[tight] > (double)state->load[tight] * instance->capacities[k])
+            {
+                tight = k;
+            }
+        }
+        // Clé négative : le tournoi retient le plus lourd ; seuls les objets tirés sont renseignés
+        for (int t = 0; t < state->count; t++)
+        {
+            int i = state->selected[t];
+            scratch[i] = -instance->weights[tight][i];
+        }
+    }
+    for (int r = 0; r < q && state->count > 0; r++)
+    {
+        int i;
+        switch (op)
+        {
+        case ALNS_DESTROY_WORST:
+            i = tournament(state, rng, efficiency);
+            break;
+        case ALNS_DESTROY_CONSTRAINT:
+            i = tournament(state, rng, scratch);
+            break;
+        case ALNS_DESTROY_HISTORY:
+        {
+            int chosen = state->selected[rng_int(rng, state->count)];
+            for (int t = 1; t < ALNS_TOURNAMENT; t++)
+            {
+                int j = state->selected[rng_int(rng, state->count)];
+                if (history[j] < history[chosen])
+                {
+                    chosen = j;
+                }
+            }
+            i = chosen;
+            break;
+        }
+        default:
+            i = state->selected[rng_int(rng, state->count)];
+            break;
+        }
+        remove_item(state, i);
+    }
+}
+
+// Ajout glouton suivant `order` ; avec `skip` > 0, chaque candidat est écarté avec cette probabilité
+static void greedy_fill(AlnsState *state, const int *order, double skip, RngState *rng)
+{
+    for (int r = 0; r < state->instance->n; r++)
+    {
+        int i = order[r];
+        if (state->x[i] || state->blocked[i] == state->stamp || (skip > 0 && rng_double(rng) < skip))
+        {
+            continue;
+        }
+        if (fits(state, i))
+        {
+            apply(state, i);
+        }
+    }
+}
+
+static void repair(AlnsState *state, AlnsRepair op, RngState *rng, const int *efficiency_order_items, const int *dual_order)
+{
+    switch (op)
+    {
+    case ALNS_REPAIR_DUAL:
+        greedy_fill(state, dual_order, 0.0, rng);
+        break;
+    case ALNS_REPAIR_RANDOM:
+        greedy_fill(state, efficiency_order_items, ALNS_RANDOM_SKIP, rng);
+        greedy_fill(state, efficiency_order_items, 0.0, rng);
+        break;
+    default:
+        greedy_fill(state, efficiency_order_items, 0.0, rng);
+        break;
+    }
+}
+
+// Tirage proportionnel aux poids
+static int roulette(const AlnsOperatorStats *ops, int count, RngState *rng)
+{
+    double total = 0.0;
+    for (int o = 0; o < count; o++)
+    {
+        total += ops[o].weight;
+    }
+    double r = rng_double(rng) * total;
+    for (int o = 0; o < count - 1; o++)
+    {
+        r -= ops[o].weight;
+        if (r < 0)
+        {
+            return o;
+        }
+    }
+    return count - 1;
+}
+
+// Fin de segment : poids lissé vers le score moyen du segment
+static void update_weights(AlnsOperatorStats *ops, double *scores, long *uses, int count, double reaction)
+{
+    for (int o = 0; o < count; o++)
+    {
+        if (uses[o] > 0)
+        {
+            ops[o].weight = (1.0 - reaction) * ops[o].weight + reaction * scores[o] / uses[o];
+            if (ops[o].weight < ALNS_MIN_WEIGHT)
+            {
+                ops[o].weight = ALNS_MIN_WEIGHT;
+            }
+        }
+        scores[o] = 0.0;
+        uses[o] = 0;
+    }
+}
+
+AlnsConfig default_alns_config(void)
+{
+    AlnsConfig config;
+    config.destroy_min = 2;
+    config.destroy_max = 15;
+    config.segment = 100;
+    config.reaction = 0.1;
+    config.start_temperature = 0.01;
+    config.cooling = 0.9999;
+    config.iterations = 100000000;
+    config.seed = 1;
+    return config;
+}
+
+void alns_search(const KnapsackInstance *instance, const AlnsConfig *config, double time_limit, AlnsResult *result)
+{
+    TimeValue start = get_current_time();
+    int n = instance->n;
+    int m = instance->m;
+    memset(result, 0, sizeof(AlnsResult));
+    for (int o = 0; o < ALNS_DESTROY_COUNT; o++)
+    {
+        result->destroy[o].name = destroy_names[o];
+        result->destroy[o].weight = 1.0;
+    }
+    for (int o = 0; o < ALNS_REPAIR_COUNT; o++)
+    {
+        result->repair[o].name = repair_names[o];
+        result->repair[o].weight = 1.0;
+    }
+
+    RngState rng;
+    rng_seed(&rng, config->seed);
+
+    AlnsState state;
+    state.instance = instance;
+    state.x = (int *)calloc(n, sizeof(int));
+    state.load = (int *)calloc(m, sizeof(int));
+    state.selected = (int *)malloc(n * sizeof(int));
+    state.position = (int *)malloc(n * sizeof(int));
+    state.blocked = (int *)calloc(n, sizeof(int));
+    state.moves = (int *)malloc(2 * (size_t)n * sizeof(int));
+    double *efficiency = (double *)malloc(n * sizeof(double));
+    double *scratch = (double *)malloc(n * sizeof(double));
+    int *history = (int *)calloc(n, sizeof(int));
+    if (!state.x || !state.load || !state.selected || !state.position || !state.blocked || !state.moves || !efficiency || !scratch || !history)
+    {
+        perror("Erreur d'allocation mémoire (alns_search)");
+        exit(EXIT_FAILURE);
+    }
+    state.Z = 0;
+    state.count = 0;
+    state.stamp = 1; // blocked vaut 0 : aucun objet bloqué au départ
+    state.move_count = 0;
+    for (int i = 0; i < n; i++)
+    {
+        state.position[i] = -1;
+        efficiency[i] = efficiency_ratio(instance, i);
+    }
+
+    // Ordres des réparations : efficacité, et pseudo-utilités surrogate
+    int *by_efficiency = efficiency_order(instance);
+    int *by_dual = surrogate_utility_order(instance, 30);
+
+    // Départ : glouton par efficacité
+    greedy_fill(&state, by_efficiency, 0.0, &rng);
+    state.move_count = 0;
+    result->best = init_solution(n);
+    memcpy(result->best->x, state.x, n * sizeof(int));
+    result->best->Z = state.Z;
+
+    double start_temperature = config->start_temperature * (state.Z > 0 ? state.Z : 1);
+    double temperature = start_temperature;
+    double destroy_scores[ALNS_DESTROY_COUNT] = {0};
+    double repair_scores[ALNS_REPAIR_COUNT] = {0};
+    long destroy_uses[ALNS_DESTROY_COUNT] = {0};
+    long repair_uses[ALNS_REPAIR_COUNT] = {0};
+    int span = config->destroy_max - config->destroy_min + 1;
+
+    long it;
+    for (it = 0; it < config->iterations && !target_reached(result->best->Z); it++)
+    {
+        if ((it & 63) == 0 && time_exceeded(start, time_limit))
+        {
+            break;
+        }
+        AlnsDestroy d = (AlnsDestroy)roulette(result->destroy, ALNS_DESTROY_COUNT, &rng);
+        AlnsRepair r = (AlnsRepair)roulette(result->repair, ALNS_REPAIR_COUNT, &rng);
+        int q = config->destroy_min + (span > 1 ? rng_int(&rng, span) : 0);
+        int previous = state.Z;
+        state.stamp++;
+        state.move_count = 0;
+
+        TimeValue t0 = get_current_time();
+        destroy(&state, d, q, &rng, efficiency, scratch, history);
+        TimeValue t1 = get_current_time();
+        repair(&state, r, &rng, by_efficiency, by_dual);
+        TimeValue t2 = get_current_time();
+        result->destroy[d].time += get_elapsed_time(t0, t1);
+        result->repair[r].time += get_elapsed_time(t1, t2);
+        result->destroy[d].uses++;
+        result->repair[r].uses++;
+        destroy_uses[d]++;
+        repair_uses[r]++;
+
+        // Acceptation par recuit simulé
+        int delta = state.Z - previous;
+        double score = 0.0;
+        int accepted = delta >= 0 || (temperature > 1e-12 && rng_double(&rng) < exp(delta / temperature));
+        if (state.Z > result->best->Z)
+        {
+            memcpy(result->best->x, state.x, n * sizeof(int));
+            result->best->Z = state.Z;
+            for (int t = 0; t < state.count; t++)
+            {
+                history[state.selected[t]]++;
+            }
+            score = ALNS_SCORE_BEST;
+            result->destroy[d].new_bests++;
+            result->repair[r].new_bests++;
+        }
+        else if (delta > 0)
+        {
+            score = ALNS_SCORE_IMPROVED;
+        }
+        else if (accepted && delta < 0)
+        {
+            score = ALNS_SCORE_ACCEPTED;
+        }
+        if (delta > 0)
+        {
+            result->destroy[d].improvements++;
+            result->repair[r].improvements++;
+        }
+        if (accepted)
+        {
+            result->destroy[d].accepted++;
+            result->repair[r].accepted++;
+        }
+        else
+        {
+            undo(&state);
+        }
+        destroy_scores[d] += score;
+        repair_scores[r] += score;
+        // Refroidissement, puis réchauffe une fois la recherche figée
+        temperature *= config->cooling;
+        if (temperature < ALNS_REHEAT * start_temperature)
+        {
+            temperature = start_temperature;
+        }
+
+        if (config->segment > 0 && (it + 1) % config->segment == 0)
+        {
+            update_weights(result->destroy, destroy_scores, destroy_uses, ALNS_DESTROY_COUNT, config->reaction);
+            update_weights(result->repair, repair_scores, repair_uses, ALNS_REPAIR_COUNT, config->reaction);
+        }
+    }
+    result->iterations = it;
+
+    free(by_efficiency);
+    free(by_dual);
+    free(state.x);
+    free(state.load);
+    free(state.selected);
+    free(state.position);
+    free(state.blocked);
+    free(state.moves);
+    free(efficiency);
+    free(scratch);
+    free(history);
+}
+
+void alns_print_stats(const AlnsResult *result)
+{
+    printf("+-------------+----------------------------+------------+------------+------------+------------+------------+---------+\n");
+    printf("| %-11s | %-28s | %10s | %10s | %10s | %10s | %10s | %7s |\n", "Type", "Opérateur", "Appels", "Acceptés", "Améliorés", "Meilleurs", "Temps (s)", "Poids");
+    printf("+-------------+----------------------------+------------+------------+------------+------------+------------+---------+\n");
+    for (int o = 0; o < ALNS_DESTROY_COUNT + ALNS_REPAIR_COUNT; o++)
+    {
+        int is_destroy = o < ALNS_DESTROY_COUNT;
+        const AlnsOperatorStats *op = is_destroy ? &result->destroy[o] : &result->repair[o - ALNS_DESTROY_COUNT];
+        printf("| %-11s | %-28s | %10ld | %10ld | %10ld | %10ld | %10.3f | %7.3f |\n", is_destroy ? "Destruction" : "Réparation", op->name, op->uses, op->accepted, op->improvements, op->new_bests, op->time, op->weight);
+    }
+    printf("+-------------+----------------------------+------------+------------+------------+------------+------------+---------+\n");
+    printf("%ld itérations\n", result->iterations);
+}
+
+void alns_export_stats(const AlnsResult *result, const char *filename)
+{
+    FILE *file = fopen(filename, "w");
+    if (!file)
+    {
+        perror("Erreur d'ouverture du fichier CSV");
+        return;
+    }
+    fprintf(file, "kind,name,uses,accepted,improvements,new_bests,time,time_per_use,weight\n");
+    for (int o = 0; o < ALNS_DESTROY_COUNT + ALNS_REPAIR_COUNT; o++)
+    {
+        int is_destroy = o < ALNS_DESTROY_COUNT;
+        const AlnsOperatorStats *op = is_destroy ? &result->destroy[o] : &result->repair[o - ALNS_DESTROY_COUNT];
+        fprintf(file, "\"%s\",\"%s\",%ld,%ld,%ld,%ld,%lf,%.9lf,%lf\n", is_destroy ? "destroy" : "repair", op->name, op->uses, op->accepted, op->improvements, op->new_bests, op->time, op->uses > 0 ? op->time / op->uses : 0.0, op->weight);
+    }
+    fclose(file);
+}
+
+void alns_free(AlnsResult *result)
+{
+    if (result->best)
+    {
+        free_solution(result->best);
+    }
+    result->best = NULL;
+}
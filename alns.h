@@ -0,0 +1,118 @@
+#ifndef ALNS_H
+#define ALNS_H
+
+#include "heuristique.h"
+
+/**
+ * @brief Opérateurs de destruction : chacun retire q objets de la solution courante.
+ */
+typedef enum {
+    ALNS_DESTROY_RANDOM,     ///< Objets sélectionnés tirés au hasard.
+    ALNS_DESTROY_WORST,      ///< Objets de plus faible efficacité (tournoi de 3 tirages).
+    ALNS_DESTROY_CONSTRAINT, ///< Objets les plus lourds sur la contrainte la plus chargée (tournoi de 3 tirages).
+    ALNS_DESTROY_HISTORY,    ///< Objets les plus rarement présents dans les meilleures solutions successives (tournoi de 3 tirages).
+    ALNS_DESTROY_COUNT
+} AlnsDestroy;
+
+/**
+ * @brief Opérateurs de réparation : chacun ajoute des objets tant qu'ils tiennent.
+ */
+typedef enum {
+    ALNS_REPAIR_GREEDY, ///< Glouton par efficacité décroissante (`efficiency_order`).
+    ALNS_REPAIR_DUAL,   ///< Glouton par pseudo-utilité selon les multiplicateurs surrogate (`surrogate_utility_order`).
+    ALNS_REPAIR_RANDOM, ///< Glouton par efficacité dont chaque candidat est écarté avec probabilité 0.3, puis complété.
+    ALNS_REPAIR_COUNT
+} AlnsRepair;
+
+/**
+ * @brief Statistiques d'un opérateur.
+ */
+typedef struct {
+    const char *name;  ///< Nom de l'opérateur.
+    long uses;         ///< Nombre d'appels.
+    long accepted;     ///< Solutions acceptées comme solution courante.
+    long improvements; ///< Solutions meilleures que la solution courante.
+    long new_bests;    ///< Nouvelles meilleures solutions.
+    double time;       ///< Temps cumulé passé dans l'opérateur (secondes).
+    double weight;     ///< Poids final de l'opérateur.
+} AlnsOperatorStats;
+
+/**
+ * @brief Paramètres de la recherche adaptative à grand voisinage (ALNS).
+ *
+ * À chaque itération, un opérateur de destruction et un opérateur de réparation sont tirés
+ * proportionnellement à leurs poids. Chaque usage rapporte un score (33 pour une nouvelle
+ * meilleure solution, 9 pour une amélioration de la solution courante, 13 pour une solution
+ * moins bonne acceptée) ; à la fin de chaque segment, le poids devient
+ * (1 - reaction) × poids + reaction × score moyen du segment. La solution obtenue est
+ * acceptée selon un critère de recuit simulé ; la température est remise à sa valeur initiale
+ * lorsqu'elle tombe sous 1 % de celle-ci.
+ */
+typedef struct {
+    int destroy_min;          ///< Nombre minimal d'objets retirés.
+    int destroy_max;          ///< Nombre maximal d'objets retirés.
+    int segment;              ///< Itérations entre deux mises à jour des poids.
+    double reaction;          ///< Facteur de réaction des poids, dans ]0, 1].
+    double start_temperature; ///< Température initiale, en fraction de la valeur de départ.
+    double cooling;           ///< Facteur de refroidissement par itération.
+    long iterations;          ///< Nombre maximal d'itérations.
+    unsigned long long seed;  ///< Graine du générateur propre à la recherche.
+} AlnsConfig;
+
+/**
+ * @brief Résultat de l'ALNS : meilleure solution et statistiques par opérateur.
+ */
+typedef struct {
+    KnapsackSolution *best;                        ///< Meilleure solution trouvée.
+    long iterations;                               ///< Nombre d'itérations effectuées.
+    AlnsOperatorStats destroy[ALNS_DESTROY_COUNT]; ///< Statistiques des opérateurs de destruction.
+    AlnsOperatorStats repair[ALNS_REPAIR_COUNT];   ///< Statistiques des opérateurs de réparation.
+} AlnsResult;
+
+/**
+ * @brief Retourne la configuration par défaut (2 à 15 objets retirés, segments de 100 itérations).
+ *
+ * @return La configuration par défaut.
+ */
+AlnsConfig default_alns_config(void);
+
+/**
+ * @brief Exécute l'ALNS jusqu'au nombre d'itérations ou à l'échéance.
+ *
+ * Les charges des contraintes et la liste des objets sélectionnés sont tenues à jour à
+ * chaque retrait et à chaque ajout (O(m)) : une destruction coûte O(q·m), et une itération
+ * rejetée est annulée en rejouant ses mouvements à l'envers, sans réévaluer la solution.
+ * Les objets retirés ne peuvent pas être remis par la réparation de la même itération.
+ *
+ * @param instance Instance du problème.
+ * @param config Paramètres de la recherche.
+ * @param time_limit Durée maximale en secondes (0 pour illimité).
+ * @param result Résultat, alloué par la fonction (à libérer avec `alns_free`).
+ */
+void alns_search(const KnapsackInstance *instance, const AlnsConfig *config, double time_limit, AlnsResult *result);
+
+/**
+ * @brief Affiche le tableau des statistiques des opérateurs.
+ *
+ * @param result Résultat de l'ALNS.
+ */
+void alns_print_stats(const AlnsResult *result);
+
+/**
+ * @brief Exporte les statistiques des opérateurs au format CSV.
+ *
+ * Une ligne par opérateur : kind,name,uses,accepted,improvements,new_bests,time,time_per_use,weight.
+ *
+ * @param result Résultat de l'ALNS.
+ * @param filename Fichier de sortie.
+ */
+void alns_export_stats(const AlnsResult *result, const char *filename);
+
+/**
+ * @brief Libère le résultat de l'ALNS.
+ *
+ * @param result Résultat à libérer.
+ */
+void alns_free(AlnsResult *result);
+
+#endif // ALNS_H
@@ -2,12 +2,13 @@
 
 double get_cpu_time()
 {
-    return (double)clock() / CLOCKS_PER_SEC;
+    // Temps CPU du thread : reste juste lorsque plusieurs cellules tournent en parallèle
+    return get_thread_cpu_time();
 }
 
 ResultEntry run_experiment(const KnapsackInstance *instance, KnapsackSolution *(*initialization_function)(const KnapsackInstance *), int temps_max, int vns_iteration,  const char *filename, int k_perturbation)
 {
-    ResultEntry result = {"", 0.0, 0.0, 0,k_perturbation, "vnc", 0, 0.0, 0, vns_iteration};
+    ResultEntry result = {"", 0.0, 0.0, 0,k_perturbation, "vnc", 0, 0.0, 0, vns_iteration, 0.0, 0, 0.0};
     
     double start_time = get_cpu_time();
     KnapsackSolution *solution = initialization_function(instance);
@@ -26,7 +27,7 @@ ResultEntry run_experiment(const KnapsackInstance *instance, KnapsackSolution *(
 
 ResultEntry run_genetic_algorithm(const KnapsackInstance *instance, int population_size, int generations, double mutation_rate, int temps_max, const char *filename) {
 
-    ResultEntry result = {"", 0.0, 0.0, 0 ,0, "genetic", population_size, mutation_rate, generations, 0};
+    ResultEntry result = {"", 0.0, 0.0, 0 ,0, "genetic", population_size, mutation_rate, generations, 0, 0.0, 0, 0.0};
 
     double start_time = get_cpu_time();
     KnapsackSolution *solution = genetic_algorithm(instance, population_size, generations, mutation_rate, temps_max);
@@ -43,7 +44,7 @@ ResultEntry run_genetic_algorithm(const KnapsackInstance *instance, int populati
 
 ResultEntry run_hybrid_algorithm(const KnapsackInstance *instance, int population_size, int generations, double mutation_rate, int vns_iterations, int k_perturbation, int temps_max, const char *filename) {
 
-    ResultEntry result = {"", 0.0, 0.0, 0,k_perturbation, "genetic", population_size, mutation_rate, generations, vns_iterations};
+    ResultEntry result = {"", 0.0, 0.0, 0,k_perturbation, "genetic", population_size, mutation_rate, generations, vns_iterations, 0.0, 0, 0.0};
     double start_time = get_cpu_time();
     KnapsackSolution *solution = hybrid_GA_VNS(instance, population_size, generations, mutation_rate, vns_iterations, k_perturbation, temps_max);
     double end_time = get_cpu_time();
@@ -67,34 +68,44 @@ ExperimentalResultsKSM run_all_experiments(const KnapsackInstance *instance, int
 
     results.genetic = run_genetic_algorithm(instance, population_size, generations, mutation_rate, temps_max, filename);
     results.hybrid = run_hybrid_algorithm(instance, population_size, generations, mutation_rate, vns_iteration, k_perturbation, temps_max, filename);
+    results.lp_bound = lp_upper_bound(instance);
     return results;
 }
 
+// Écart relatif (%) entre la borne LP et la valeur
+static double lp_gap(double bound, double value)
+{
+    return bound > 0 ? 100.0 * (bound - value) / bound : 0.0;
+}
+
 void print_results_table(const ExperimentalResultsKSM *results)
 {  
     // principalement utiliser dans le main()
     // Ligne de séparation complète avec la colonne Tailles
-    printf("+------------------------------+-------------------------+-------------------------+----------+\n");
+    printf("+------------------------------+-------------------------+-------------------------+----------+--------------+\n");
 
     // En-têtes des colonnes bien alignés
-    printf("| %-28s | %-21s | %-21s | %-8s |\n",   "Combinaison", "Valeur de la solution", "Temps CPU (secondes)", "Tailles");
+    printf("| %-28s | %-21s | %-21s | %-8s | %-12s |\n",   "Combinaison", "Valeur de la solution", "Temps CPU (secondes)", "Tailles", "Écart LP (%)");
 
     // Ligne de séparation
-    printf("+------------------------------+-------------------------+-------------------------+----------+\n");
+    printf("+------------------------------+-------------------------+-------------------------+----------+--------------+\n");
 
     // Ligne Gloutonne - alignement parfait avec les en-têtes
-    printf("| %-28s | %21.2f | %21.6f | %8d |\n",  "VNS Gloutonne",  results->greedy_vns.value, results->greedy_vns.time,  results->greedy_vns.length);
+    printf("| %-28s | %21.2f | %21.6f | %8d | %12.4f |\n",  "VNS Gloutonne",  results->greedy_vns.value, results->greedy_vns.time,  results->greedy_vns.length, lp_gap(results->lp_bound, results->greedy_vns.value));
 
     // Ligne Aléatoire 
-    printf("| %-28s | %21.2f | %21.6f | %8d |\n", "VNS Aléatoire",  results->random_vns.value,     results->random_vns.time,     results->random_vns.length);
+    printf("| %-28s | %21.2f | %21.6f | %8d | %12.4f |\n", "VNS Aléatoire",  results->random_vns.value,     results->random_vns.time,     results->random_vns.length, lp_gap(results->lp_bound, results->random_vns.value));
     // Ligne Génétique
 
-    printf("| %-28s | %21.2f | %21.6f | %8d |\n", "Génétique", results->genetic.value, results->genetic.time, results->genetic.length);
+    printf("| %-28s | %21.2f | %21.6f | %8d | %12.4f |\n", "Génétique", results->genetic.value, results->genetic.time, results->genetic.length, lp_gap(results->lp_bound, results->genetic.value));
     // Ligne Hybride GA + VNS
-    printf("| %-28s | %21.2f | %21.6f | %8d |\n", "Hybride GA + VNS", results->hybrid.value, results->hybrid.time, results->hybrid.length);
+    printf("| %-28s | %21.2f | %21.6f | %8d | %12.4f |\n", "Hybride GA + VNS", results->hybrid.value, results->hybrid.time, results->hybrid.length, lp_gap(results->lp_bound, results->hybrid.value));
+
+    // Ligne de la borne de la relaxation linéaire
+    printf("| %-28s | %21.2f | %21s | %8s | %12s |\n", "Borne LP", results->lp_bound, "", "", "");
 
     // Ligne de séparation finale
-    printf("+------------------------------+-------------------------+-------------------------+----------+\n");
+    printf("+------------------------------+-------------------------+-------------------------+----------+--------------+\n");
 }
 
 /**
@@ -155,6 +166,31 @@ int basic_test(int is_directory_mode, const char *path_instance, int temps_max,
     return 0;
 }
 
+// En-tête et ligne CSV partagés par export_csv et l'exécuteur de grille
+static void write_csv_header(FILE *file)
+{
+    fprintf(file, "filename,value,time,length,k_perturbation,type,pop_size,mutation_rate,generations,vns_iterations,wall_time,repetition,lp_bound,gap\n");
+}
+
+static void write_csv_row(FILE *file, const ResultEntry *result)
+{
+    fprintf(file, "\"%s\",%lf,%lf,%d,%d,\"%s\",%d,%lf,%d,%d,%lf,%d,%lf,%lf\n",
+            result->filename,
+            result->value,
+            result->time,
+            result->length,
+            result->k_perturbation,
+            result->type,
+            result->pop_size,
+            result->mutation_rate,
+            result->generations,
+            result->vns_iterations,
+            result->wall_time,
+            result->repetition,
+            result->lp_bound,
+            lp_gap(result->lp_bound, result->value));
+}
+
 void export_csv(ResultEntry *results, int data_index, const char *filename)
 {
     FILE *file = fopen(filename, "w");
@@ -165,21 +201,11 @@ void export_csv(ResultEntry *results, int data_index, const char *filename)
     }
 
     // Écriture de l'en-tête
-    fprintf(file, "filename,value,time,length,k_perturbation,type,pop_size,mutation_rate,generations,vns_iterations\n");
+    write_csv_header(file);
 
     // Parcours du tableau de ResultEntry et écriture des données
     for (int i = 0; i < data_index; i++) {
-        fprintf(file, "\"%s\",%lf,%lf,%d,%d,\"%s\",%d,%lf,%d,%d\n", 
-                results[i].filename,
-                results[i].value,
-                results[i].time,
-                results[i].length,
-                results[i].k_perturbation,
-                results[i].type,
-                results[i].pop_size,
-                results[i].mutation_rate,
-                results[i].generations,
-                results[i].vns_iterations);
+        write_csv_row(file, &results[i]);
     }
 
     // Fermeture du fichier
@@ -187,6 +213,236 @@ void export_csv(ResultEntry *results, int data_index, const char *filename)
     printf("Données exportées avec succès.\n");
 }
 
+////////////////////////////////////////////////////////////////// Grille d'expériences
+
+int benchmark_thread_count = 1;
+int benchmark_repetitions = 1;
+
+void benchmark_grid_init(BenchmarkGrid *grid)
+{
+    memset(grid, 0, sizeof(BenchmarkGrid));
+    grid->repetitions = benchmark_repetitions;
+    grid->seed = (unsigned long long)time(NULL);
+}
+
+const KnapsackInstance *benchmark_grid_load_instance(BenchmarkGrid *grid, const char *path)
+{
+    if (grid->instance_count == grid->instance_capacity)
+    {
+        int new_capacity = grid->instance_capacity ? grid->instance_capacity * 2 : 8;
+        KnapsackInstance **instances = (KnapsackInstance **)realloc(grid->instances, new_capacity * sizeof(KnapsackInstance *));
+        if (!instances)
+        {
+            perror("Erreur d'allocation mémoire pour les instances (benchmark_grid_load_instance)");
+            exit(EXIT_FAILURE);
+        }
+        grid->instances = instances;
+        grid->instance_capacity = new_capacity;
+    }
+    KnapsackInstance *instance = (KnapsackInstance *)malloc(sizeof(KnapsackInstance));
+    if (!instance)
+    {
+        perror("Erreur d'allocation mémoire pour une instance (benchmark_grid_load_instance)");
+        exit(EXIT_FAILURE);
+    }
+    read_knapsack_file(path, instance);
+    grid->instances[grid->instance_count++] = instance;
+    return instance;
+}
+
+BenchmarkCell *benchmark_grid_add_cell(BenchmarkGrid *grid)
+{
+    if (grid->count == grid->capacity)
+    {
+        int new_capacity = grid->capacity ? grid->capacity * 2 : 64;
+        BenchmarkCell *cells = (BenchmarkCell *)realloc(grid->cells, new_capacity * sizeof(BenchmarkCell));
+        if (!cells)
+        {
+            perror("Erreur d'allocation mémoire pour les cellules (benchmark_grid_add_cell)");
+            exit(EXIT_FAILURE);
+        }
+        grid->cells = cells;
+        grid->capacity = new_capacity;
+    }
+    BenchmarkCell *cell = &grid->cells[grid->count++];
+    memset(cell, 0, sizeof(BenchmarkCell));
+    return cell;
+}
+
+// Ajoute les deux cellules VNS gloutonne / VNS aléatoire d'une combinaison de paramètres
+static void add_vns_pair(BenchmarkGrid *grid, const KnapsackInstance *instance, const char *filename, int temps_max, int iteration, int k_perturbation, int reported_time)
+{
+    KnapsackSolution *(*initializations[2])(const KnapsackInstance *) = {greedy_initial_solution, random_initial_solution};
+    const char *types[2] = {"vns_gloutonne", "vns_aleatoire"};
+    for (int i = 0; i < 2; i++)
+    {
+        BenchmarkCell *cell = benchmark_grid_add_cell(grid);
+        cell->kind = CELL_VNS;
+        cell->instance = instance;
+        snprintf(cell->filename, sizeof(cell->filename), "%s", filename);
+        cell->type = types[i];
+        cell->initialization_function = initializations[i];
+        cell->temps_max = temps_max;
+        cell->vns_iterations = iteration;
+        cell->k_perturbation = k_perturbation;
+        cell->reported_time = reported_time;
+    }
+}
+
+static void add_genetic_cell(BenchmarkGrid *grid, const KnapsackInstance *instance, const char *filename, int population_size, int generations, double mutation_rate, int temps_max)
+{
+    BenchmarkCell *cell = benchmark_grid_add_cell(grid);
+    cell->kind = CELL_GENETIC;
+    cell->instance = instance;
+    snprintf(cell->filename, sizeof(cell->filename), "%s", filename);
+    cell->type = "genetic";
+    cell->population_size = population_size;
+    cell->generations = generations;
+    cell->mutation_rate = mutation_rate;
+    cell->temps_max = temps_max;
+}
+
+static void add_hybrid_cell(BenchmarkGrid *grid, const KnapsackInstance *instance, const char *filename, int population_size, int generations, double mutation_rate, int vns_iterations, int k_perturbation, int temps_max)
+{
+    BenchmarkCell *cell = benchmark_grid_add_cell(grid);
+    cell->kind = CELL_HYBRID;
+    cell->instance = instance;
+    snprintf(cell->filename, sizeof(cell->filename), "%s", filename);
+    cell->type = "hybrid";
+    cell->population_size = population_size;
+    cell->generations = generations;
+    cell->mutation_rate = mutation_rate;
+    cell->vns_iterations = vns_iterations;
+    cell->k_perturbation = k_perturbation;
+    cell->temps_max = temps_max;
+}
+
+typedef struct {
+    BenchmarkGrid *grid;
+    FILE *csv;
+    pthread_mutex_t lock;
+    int completed;
+    int total;
+} GridRun;
+
+typedef struct {
+    GridRun *run;
+    int index;
+} GridTask;
+
+static ResultEntry run_cell(const BenchmarkCell *cell)
+{
+    ResultEntry result;
+    switch (cell->kind)
+    {
+    case CELL_VNS:
+        result = run_experiment(cell->instance, cell->initialization_function, cell->temps_max, cell->vns_iterations, cell->filename, cell->k_perturbation);
+        result.vns_iterations = cell->vns_iterations;
+        break;
+    case CELL_GENETIC:
+        result = run_genetic_algorithm(cell->instance, cell->population_size, cell->generations, cell->mutation_rate, cell->temps_max, cell->filename);
+        break;
+    default:
+        result = run_hybrid_algorithm(cell->instance, cell->population_size, cell->generations, cell->mutation_rate, cell->vns_iterations, cell->k_perturbation, cell->temps_max, cell->filename);
+        break;
+    }
+    result.type = (char *)cell->type;
+    result.lp_bound = lp_upper_bound(cell->instance);
+    if (cell->reported_time > 0)
+    {
+        result.time = cell->reported_time;
+    }
+    return result;
+}
+
+static void grid_task_run(void *arg)
+{
+    GridTask *task = (GridTask *)arg;
+    GridRun *run = task->run;
+    BenchmarkGrid *grid = run->grid;
+    const BenchmarkCell *cell = &grid->cells[task->index / grid->repetitions];
+
+    // Chaque cellule tire ses nombres aléatoires d'un générateur qui lui est propre
+    RngState rng;
+    rng_seed(&rng, rng_derive(grid->seed, (unsigned long long)task->index));
+    RngState *previous = rng_bind(&rng);
+
+    TimeValue start = get_current_time();
+    ResultEntry result = run_cell(cell);
+    result.wall_time = get_elapsed_time(start, get_current_time());
+    result.repetition = task->index % grid->repetitions;
+
+    rng_bind(previous);
+
+    // Le résultat est écrit dès que la cellule se termine
+    pthread_mutex_lock(&run->lock);
+    write_csv_row(run->csv, &result);
+    fflush(run->csv);
+    run->completed++;
+    printf("[%d/%d] %s %s : valeur %.0f, CPU %.3f s, mur %.3f s\n", run->completed, run->total, result.filename, result.type, result.value, result.time, result.wall_time);
+    pthread_mutex_unlock(&run->lock);
+}
+
+int run_benchmark_grid(BenchmarkGrid *grid, int thread_count, const char *csv_filename)
+{
+    FILE *csv = fopen(csv_filename, "w");
+    if (!csv)
+    {
+        perror("Erreur d'ouverture du fichier CSV");
+        return 1;
+    }
+    write_csv_header(csv);
+    fflush(csv);
+
+    GridRun run;
+    run.grid = grid;
+    run.csv = csv;
+    pthread_mutex_init(&run.lock, NULL);
+    run.completed = 0;
+    run.total = grid->count * grid->repetitions;
+
+    GridTask *tasks = (GridTask *)malloc((run.total > 0 ? run.total : 1) * sizeof(GridTask));
+    ThreadPool *pool = thread_pool_create(thread_count);
+    if (!tasks || !pool)
+    {
+        perror("Erreur d'allocation mémoire pour la grille (run_benchmark_grid)");
+        free(tasks);
+        thread_pool_destroy(pool);
+        fclose(csv);
+        return 1;
+    }
+
+    printf("Grille de %d cellules sur %d threads.\n", run.total, thread_count);
+    for (int i = 0; i < run.total; i++)
+    {
+        tasks[i].run = &run;
+        tasks[i].index = i;
+        thread_pool_submit(pool, grid_task_run, &tasks[i]);
+    }
+    thread_pool_wait(pool);
+
+    thread_pool_destroy(pool);
+    free(tasks);
+    pthread_mutex_destroy(&run.lock);
+    fclose(csv);
+    printf("Données exportées avec succès dans %s.\n", csv_filename);
+    return 0;
+}
+
+void benchmark_grid_free(BenchmarkGrid *grid)
+{
+    for (int i = 0; i < grid->instance_count; i++)
+    {
+        free_knapsack_instance(grid->instances[i]);
+        free(grid->instances[i]);
+    }
+    free(grid->instances);
+    free(grid->cells);
+    memset(grid, 0, sizeof(BenchmarkGrid));
+}
+
+////////////////////////////////////////////////////////////////// Expériences
+
 int vns_gloutonne_vs_aleatoire(const char *repertoire, int temps_max, int iteration, int k_perturbation)
 {
     printf("Test vns_gloutonne_vs_aleatoire.\n");
@@ -199,9 +455,8 @@ int vns_gloutonne_vs_aleatoire(const char *repertoire, int temps_max, int iterat
     }
 
     struct dirent *entry;
-    // Tableau pour stocker les résultats à exporter
-    ResultEntry results[SIZE_RESULT_BUFFER];
-    int data_index = 0;
+    BenchmarkGrid grid;
+    benchmark_grid_init(&grid);
 
     // Lire les fichiers du répertoire
     while ((entry = readdir(dir)) != NULL)
@@ -213,43 +468,26 @@ int vns_gloutonne_vs_aleatoire(const char *repertoire, int temps_max, int iterat
         // Vérifier si c'est un fichier régulier
         if (stat(full_path, &st) == 0 && S_ISREG(st.st_mode))
         {
-            printf("\n\n=== Instance : %s ===\n", entry->d_name);
-            KnapsackInstance ksInstance;
-            read_knapsack_file(full_path, &ksInstance);
-
-            // Exécuter les expériences VNS Gloutonne et VNS Aléatoire
-            ResultEntry greedy_result = run_experiment(&ksInstance, greedy_initial_solution, temps_max,iteration,  entry->d_name, k_perturbation);
-            greedy_result.type = "vns_gloutonne";
-            ResultEntry random_result = run_experiment(&ksInstance, random_initial_solution, temps_max,iteration,  entry->d_name, k_perturbation);
-            random_result.type = "vns_aleatoire";
-
-            // Sauvegarder les résultats dans le tableau
-            results[data_index] = greedy_result;
-            results[data_index + 1] = random_result;
-            data_index += 2;
+            const KnapsackInstance *instance = benchmark_grid_load_instance(&grid, full_path);
+            // VNS Gloutonne et VNS Aléatoire
+            add_vns_pair(&grid, instance, entry->d_name, temps_max, iteration, k_perturbation, 0);
         }
     }
 
     closedir(dir);
 
-    export_csv(results, data_index, "./benchmark/vnc_gloutonne_vs_aleatoire.csv");
+    int status = run_benchmark_grid(&grid, benchmark_thread_count, "./benchmark/vnc_gloutonne_vs_aleatoire.csv");
+    benchmark_grid_free(&grid);
 
     printf("Export des résultats terminé.\n");
-    return 0;
+    return status;
 }
 
 int vns_gloutonne_vs_aleatoire_vns_iteration(const char *repertoire, const char *fichiers[], int num_fichiers, int k_perturbation) {
     printf("Test vns_gloutonne_vs_aleatoire_vns_iteration.\n");
-    
-    // Ouvrir le répertoire
-    DIR *dir = opendir(repertoire);
-    if (!dir) {
-        perror("Erreur lors de l'ouverture du répertoire");
-        return 1;
-    }
 
-    ResultEntry results[SIZE_RESULT_BUFFER];
-    int data_index = 0;
+    BenchmarkGrid grid;
+    benchmark_grid_init(&grid);
 
     // Liste des itérations à tester
     int iterations[] = {100, 1000, 5000, 10000, 20000, 30000, 50000};
@@ -262,53 +500,29 @@ int vns_gloutonne_vs_aleatoire_vns_iteration(const char *repertoire, const char
         struct stat st;
         // Vérifie si c'est un fichier régulier
         if (stat(full_path, &st) == 0 && S_ISREG(st.st_mode)) {
-            printf("\n\n=== Instance : %s ===\n", fichiers[i]);
-            KnapsackInstance ksInstance;
-            read_knapsack_file(full_path, &ksInstance);
+            const KnapsackInstance *instance = benchmark_grid_load_instance(&grid, full_path);
 
-            // Boucle sur les différentes valeurs d'itérations
+            // Une paire de cellules par nombre d'itérations
             for (size_t j = 0; j < sizeof(iterations)/sizeof(iterations[0]); j++) {
-                int current_iteration = iterations[j];
-                printf("Exécution pour %d itérations...\n", current_iteration);
-
-                ResultEntry greedy_result = run_experiment(&ksInstance, greedy_initial_solution, 0, current_iteration, fichiers[i], k_perturbation);
-                greedy_result.type = "vns_gloutonne";
-                greedy_result.vns_iterations = current_iteration;
-
-                ResultEntry random_result = run_experiment(&ksInstance, random_initial_solution, 0, current_iteration, fichiers[i], k_perturbation);
-                random_result.type = "vns_aleatoire";
-                random_result.vns_iterations = current_iteration;
-
-                // Sauvegarder les résultats
-                results[data_index] = greedy_result;
-                results[data_index + 1] = random_result;
-                data_index += 2;
+                add_vns_pair(&grid, instance, fichiers[i], 0, iterations[j], k_perturbation, 0);
             }
         }
     }
 
-    closedir(dir);
-
     // Exporter les résultats dans un fichier CSV
-    export_csv(results, data_index, "./benchmark/vns_gloutonne_vs_aleatoire_iteration.csv");
+    int status = run_benchmark_grid(&grid, benchmark_thread_count, "./benchmark/vns_gloutonne_vs_aleatoire_iteration.csv");
+    benchmark_grid_free(&grid);
 
     printf("Export des résultats terminé.\n");
-    return 0;
+    return status;
 }
 
 
 int vns_gloutonne_vs_aleatoire_time(const char *repertoire, const char *fichiers[], int num_fichiers, int iteration, int k_perturbation) {
     printf("Test vns_gloutonne_vs_aleatoire_time.\n");
-    
-    // Ouvrir le répertoire
-    DIR *dir = opendir(repertoire);
-    if (!dir) {
-        perror("Erreur lors de l'ouverture du répertoire");
-        return 1;
-    }
 
-    ResultEntry results[SIZE_RESULT_BUFFER];
-    int data_index = 0;
+    BenchmarkGrid grid;
+    benchmark_grid_init(&grid);
 
     // Vérifie les fichiers spécifiés
     for (int i = 0; i < num_fichiers; i++) {
@@ -318,49 +532,28 @@ int vns_gloutonne_vs_aleatoire_time(const char *repertoire, const char *fichiers
         struct stat st;
         // Vérifie si c'est un fichier régulier
         if (stat(full_path, &st) == 0 && S_ISREG(st.st_mode)) {
-            printf("\n\n=== Instance : %s ===\n", fichiers[i]);
-            KnapsackInstance ksInstance;
-            read_knapsack_file(full_path, &ksInstance);
+            const KnapsackInstance *instance = benchmark_grid_load_instance(&grid, full_path);
 
             // Exécute les expériences pendant des périodes de 1 à 10 secondes
             for (int j = 1; j <= 10; j++) {
-                printf("Exécution pour %d secondes...\n", j);
-                ResultEntry greedy_result = run_experiment(&ksInstance, greedy_initial_solution, j,iteration, fichiers[i], k_perturbation);
-                greedy_result.type = "vns_gloutonne";
-                greedy_result.time = j; 
-                ResultEntry random_result = run_experiment(&ksInstance, random_initial_solution, j, iteration, fichiers[i], k_perturbation);
-                random_result.type = "vns_aleatoire";
-                random_result.time = j; 
-
-                // Sauvegarder les résultats dans le tableau
-                results[data_index] = greedy_result;
-                results[data_index + 1] = random_result;
-                data_index += 2;
+                add_vns_pair(&grid, instance, fichiers[i], j, iteration, k_perturbation, j);
             }
         }
     }
 
-    closedir(dir);
-
     // Exporter les résultats dans un fichier CSV
-    export_csv(results, data_index, "./benchmark/vns_gloutonne_vs_aleatoire_time.csv");
+    int status = run_benchmark_grid(&grid, benchmark_thread_count, "./benchmark/vns_gloutonne_vs_aleatoire_time.csv");
+    benchmark_grid_free(&grid);
 
     printf("Export des résultats terminé.\n");
-    return 0;
+    return status;
 }
 
 int vns_gloutonne_vs_aleatoire_k_perturbation(const char *repertoire, const char *fichiers[], int num_fichiers, int iteration, int temps_max) {
     printf("Test vns_gloutonne_vs_aleatoire_k.\n");
-    
-    // Ouvrir le répertoire
-    DIR *dir = opendir(repertoire);
-    if (!dir) {
-        perror("Erreur lors de l'ouverture du répertoire");
-        return 1;
-    }
 
-    ResultEntry results[SIZE_RESULT_BUFFER];
-    int data_index = 0;
+    BenchmarkGrid grid;
+    benchmark_grid_init(&grid);
 
     // Vérifie les fichiers spécifiés
     for (int i = 0; i < num_fichiers; i++) {
@@ -370,35 +563,20 @@ int vns_gloutonne_vs_aleatoire_k_perturbation(const char *repertoire, const char
         struct stat st;
         // Vérifie si c'est un fichier régulier
         if (stat(full_path, &st) == 0 && S_ISREG(st.st_mode)) {
-            printf("\n\n=== Instance : %s ===\n", fichiers[i]);
-            KnapsackInstance ksInstance;
-            read_knapsack_file(full_path, &ksInstance);
+            const KnapsackInstance *instance = benchmark_grid_load_instance(&grid, full_path);
 
-            
             for (int j = 0; j <= 50; j+=5) {
-                printf("Exécution pour k = %d...\n", j);
-
-                ResultEntry greedy_result = run_experiment(&ksInstance, greedy_initial_solution, temps_max, iteration, fichiers[i], j);
-                greedy_result.type = "vns_gloutonne";
-
-                ResultEntry random_result = run_experiment(&ksInstance, random_initial_solution, temps_max, iteration, fichiers[i], j);
-                random_result.type = "vns_aleatoire";
-
-                // Sauvegarder les résultats dans le tableau
-                results[data_index] = greedy_result;
-                results[data_index + 1] = random_result;
-                data_index += 2;
+                add_vns_pair(&grid, instance, fichiers[i], temps_max, iteration, j, 0);
             }
         }
     }
 
-    closedir(dir);
-
     // Exporter les résultats dans un fichier CSV
-    export_csv(results, data_index, "./benchmark/vns_gloutonne_vs_aleatoire_k_perturbation.csv");
+    int status = run_benchmark_grid(&grid, benchmark_thread_count, "./benchmark/vns_gloutonne_vs_aleatoire_k_perturbation.csv");
+    benchmark_grid_free(&grid);
 
     printf("Export des résultats terminé.\n");
-    return 0;
+    return status;
 }
 
 
@@ -406,52 +584,38 @@ int genetic_algorithm_tests(const char *chemin_fichier, int temps_max)
 {
     printf("Test genetic_algorithm_tests.\n");
 
-    // Ouvrir le fichier
-    FILE *file = fopen(chemin_fichier, "r");
-    if (!file)
+    struct stat st;
+    if (stat(chemin_fichier, &st) != 0 || !S_ISREG(st.st_mode))
     {
         perror("Erreur lors de l'ouverture du fichier");
         return 1;
     }
 
-    // Tableau pour stocker les résultats à exporter
-    ResultEntry results[SIZE_RESULT_BUFFER];
-    int data_index = 0;
+    BenchmarkGrid grid;
+    benchmark_grid_init(&grid);
 
     // Définir les paramètres du test
     int populations[] = {10, 100, 200, 400, 1000, 1300};
     int generations[] = {10, 50, 100, 300, 500,1000};
     double mutation_rates[] = {0.05, 0.1, 1, 6, 10, 15, 20};
 
-    // Lire le fichier (ici on suppose que le fichier contient une instance de knapsack)
-    KnapsackInstance ksInstance;
-    read_knapsack_file(chemin_fichier, &ksInstance);
+    const KnapsackInstance *instance = benchmark_grid_load_instance(&grid, chemin_fichier);
 
-    // Pour chaque combinaison de population, génération et taux de mutation
+    // Une cellule pour chaque combinaison de population, génération et taux de mutation
     for (size_t i = 0; i < sizeof(populations) / sizeof(populations[0]); i++) {
         for (size_t j = 0; j < sizeof(generations) / sizeof(generations[0]); j++) {
             for (size_t k = 0; k < sizeof(mutation_rates) / sizeof(mutation_rates[0]); k++) {
-                printf("Exécution pour population %d, générations %d, taux de mutation %.2f...\n", populations[i], generations[j], mutation_rates[k]);
-                // Exécuter l'algorithme génétique avec les paramètres
-                ResultEntry result = run_genetic_algorithm(&ksInstance, populations[i], generations[j], mutation_rates[k], temps_max, chemin_fichier);
-                result.pop_size = populations[i];
-                result.generations = generations[j];
-                result.mutation_rate = mutation_rates[k];
-
-                // Sauvegarder les résultats dans le tableau
-                results[data_index] = result;
-                data_index++;
+                add_genetic_cell(&grid, instance, chemin_fichier, populations[i], generations[j], mutation_rates[k], temps_max);
             }
         }
     }
 
-    fclose(file);
-
     // Exporter les résultats dans un fichier CSV
-    export_csv(results, data_index, "./benchmark/genetic_algorithm_tests.csv");
+    int status = run_benchmark_grid(&grid, benchmark_thread_count, "./benchmark/genetic_algorithm_tests.csv");
+    benchmark_grid_free(&grid);
 
     printf("Export des résultats terminé.\n");
-    return 0;
+    return status;
 }
 
 int run_hybrid_algorithm_test(const char *repertoire, int population_size, int generations, double mutation_rate, int vns_iterations, int k_perturbation, int temps_max)
@@ -466,9 +630,8 @@ int run_hybrid_algorithm_test(const char *repertoire, int population_size, int g
     }
 
     struct dirent *entry;
-    // Tableau pour stocker les résultats à exporter
-    ResultEntry results[SIZE_RESULT_BUFFER];
-    int data_index = 0;
+    BenchmarkGrid grid;
+    benchmark_grid_init(&grid);
 
     // Lire les fichiers du répertoire
     while ((entry = readdir(dir)) != NULL)
@@ -480,27 +643,19 @@ int run_hybrid_algorithm_test(const char *repertoire, int population_size, int g
         // Vérifier si c'est un fichier régulier
         if (stat(full_path, &st) == 0 && S_ISREG(st.st_mode))
         {
-            printf("\n\n=== Instance : %s ===\n", entry->d_name);
-            KnapsackInstance ksInstance;
-            read_knapsack_file(full_path, &ksInstance);
-
-            // Exécuter les expériences pour l'algorithme hybride et un autre algorithme
-            ResultEntry hybrid_result = run_hybrid_algorithm(&ksInstance, population_size, generations, mutation_rate, vns_iterations, k_perturbation, temps_max, entry->d_name);
-            hybrid_result.type = "hybrid";
-
-            // Sauvegarder les résultats dans le tableau
-            results[data_index] = hybrid_result;
-            data_index += 1;
+            const KnapsackInstance *instance = benchmark_grid_load_instance(&grid, full_path);
+            add_hybrid_cell(&grid, instance, entry->d_name, population_size, generations, mutation_rate, vns_iterations, k_perturbation, temps_max);
         }
     }
 
     closedir(dir);
 
     // Exporter les résultats dans un fichier CSV
-    export_csv(results, data_index, "./benchmark/hybrid_ga_vns_test.csv");
+    int status = run_benchmark_grid(&grid, benchmark_thread_count, "./benchmark/hybrid_ga_vns_test.csv");
+    benchmark_grid_free(&grid);
 
     printf("Export des résultats terminé.\n");
-    return 0;
+    return status;
 }
 
 int hybrid_vs_genetic_test(const char *repertoire, int population_size, int generations, double mutation_rate, int vns_iterations, int k_perturbation, int temps_max)
@@ -516,8 +671,8 @@ int hybrid_vs_genetic_test(const char *repertoire, int population_size, int gene
     }
 
     struct dirent *entry;
-    ResultEntry results[SIZE_RESULT_BUFFER];
-    int data_index = 0;
+    BenchmarkGrid grid;
+    benchmark_grid_init(&grid);
 
     while ((entry = readdir(dir)) != NULL)
     {
@@ -530,32 +685,58 @@ int hybrid_vs_genetic_test(const char *repertoire, int population_size, int gene
         struct stat st;
         if (stat(full_path, &st) == 0 && S_ISREG(st.st_mode))
         {
-            printf("\n\n=== Instance : %s ===\n", entry->d_name);
-
-            KnapsackInstance ksInstance;
-            read_knapsack_file(full_path, &ksInstance);
+            const KnapsackInstance *instance = benchmark_grid_load_instance(&grid, full_path);
 
-            // Exécution de l'algorithme génétique
-            ResultEntry genetic_result = run_genetic_algorithm(&ksInstance, population_size, generations, mutation_rate, temps_max, entry->d_name);
-            genetic_result.type = "genetic";
-
-            // Exécution de l'algorithme hybride (GA + VNS)
-            ResultEntry hybrid_result = run_hybrid_algorithm(&ksInstance, population_size, generations, mutation_rate, vns_iterations, k_perturbation, temps_max, entry->d_name);
-            hybrid_result.type = "hybrid";
-
-            // Sauvegarder les résultats
-            results[data_index] = genetic_result;
-            results[data_index + 1] = hybrid_result;
-            data_index += 2;
+            // Algorithme génétique puis hybride (GA + VNS)
+            add_genetic_cell(&grid, instance, entry->d_name, population_size, generations, mutation_rate, temps_max);
+            add_hybrid_cell(&grid, instance, entry->d_name, population_size, generations, mutation_rate, vns_iterations, k_perturbation, temps_max);
         }
     }
 
     closedir(dir);
 
-    export_csv(results, data_index, "./benchmark/hybrid_vs_genetic_test.csv");
+    int status = run_benchmark_grid(&grid, benchmark_thread_count, "./benchmark/hybrid_vs_genetic_test.csv");
+    benchmark_grid_free(&grid);
 
     printf("Export des résultats terminé.\n");
-    return 0;
+    return status;
+}
+
+int verify_deterministic_portfolio(const char *path_instance, int thread_count, unsigned long long seed)
+{
+    printf("Test verify_deterministic_portfolio (1 thread contre %d threads).\n", thread_count);
+
+    KnapsackInstance ksInstance;
+    read_knapsack_file(path_instance, &ksInstance);
+
+    PortfolioConfig config = default_portfolio_config();
+    config.deterministic = 1;
+    config.seed = seed;
+
+    // Même graine, même nombre d'époques, sans échéance : seul le nombre de threads change
+    config.thread_count = 1;
+    PortfolioResult sequential = portfolio_search(&ksInstance, &config, 0);
+    config.thread_count = thread_count;
+    PortfolioResult parallel = portfolio_search(&ksInstance, &config, 0);
+
+    int identical = sequential.best && parallel.best && sequential.best->Z == parallel.best->Z;
+    for (int i = 0; identical && i < ksInstance.n; i++)
+    {
+        identical = sequential.best->x[i] == parallel.best->x[i];
+    }
+    for (int i = 0; identical && i < sequential.member_count; i++)
+    {
+        identical = sequential.members[i].value == parallel.members[i].value && sequential.members[i].work_done == parallel.members[i].work_done;
+    }
+
+    print_portfolio_result(&sequential);
+    print_portfolio_result(&parallel);
+    printf("Résultats %s.\n", identical ? "identiques" : "DIFFÉRENTS");
+
+    if (sequential.best) free_solution(sequential.best);
+    if (parallel.best) free_solution(parallel.best);
+    free_knapsack_instance(&ksInstance);
+    return identical ? 0 : 1;
 }
 
 int run_all(const char *path_instance) {
@@ -592,9 +773,13 @@ int main(int argc, char *argv[])
 {
     if (argc < 3)
     {
-        printf("Usage: %s [-D] <fichier_instance|répertoire> <temps_max>\n", argv[0]);
+        printf("Usage: %s [-D] <fichier_instance|répertoire> <temps_max> [-j threads] [-r répétitions] [options du génétique]\n", argv[0]);
         printf("-Pour un fichier unique : %s <fichier_instance> <temps_max>\n", argv[0]);
         printf("-Pour un répertoire    : %s -D <repertoire_instance> <temps_max>\n", argv[0]);
+        printf("-j : nombre de threads des grilles d'expériences, -r : répétitions par cellule\n");
+        printf("-V : vérifie que le portefeuille déterministe donne le même résultat sur 1 et sur N threads (N = -j)\n");
+        printf("Options du génétique et de l'hybride des grilles :\n");
+        print_genetic_options_usage();
         return 1;
     }
 
@@ -625,6 +810,41 @@ int main(int argc, char *argv[])
     double mutation_rate = 10.0;
 
     int temps_max = atof(argv[is_directory_mode ? 3 : 2]);
+
+    // Options des grilles d'expériences
+    int verify_mode = 0;
+    GeneticConfig genetic_options = default_genetic_config();
+    for (int i = is_directory_mode ? 4 : 3; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-V") == 0)
+        {
+            verify_mode = 1;
+        }
+        else if (parse_genetic_option(argc, argv, &i, &genetic_options))
+        {
+            // Option reprise par genetic_algorithm et hybrid_GA_VNS dans toutes les cellules
+        }
+        else if (i + 1 >= argc)
+        {
+            break;
+        }
+        else if (strcmp(argv[i], "-j") == 0)
+        {
+            benchmark_thread_count = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-r") == 0)
+        {
+            benchmark_repetitions = atoi(argv[++i]);
+        }
+    }
+    if (benchmark_thread_count < 1) benchmark_thread_count = 1;
+    if (benchmark_repetitions < 1) benchmark_repetitions = 1;
+    configure_genetic_options(&genetic_options);
+
+    if (verify_mode && !is_directory_mode)
+    {
+        return verify_deterministic_portfolio(path_instance, benchmark_thread_count > 1 ? benchmark_thread_count : 4, (unsigned long long)time(NULL));
+    }
     return basic_test(is_directory_mode, path_instance, temps_max, population_size, generations, mutation_rate, vns_iterations, k_perturbation);
     
     // Attention tres couteux en mémoire, ne pas executer en meme temps que les autres
@@ -11,8 +11,10 @@
 #include <string.h>
 #include "heuristique.h"
 #include "genetic.h"
-
-#define SIZE_RESULT_BUFFER 200 
+#include "thread_pool.h"
+#include "portfolio.h"
+#include "rng.h"
+#include "lp.h"
 
 typedef struct {
     char filename[256]; // vns
@@ -25,6 +27,9 @@ typedef struct {
     double mutation_rate; // genetic
     int generations; // genetic
     int vns_iterations; // hybrid
+    double wall_time; // temps réel de la cellule
+    int repetition; // indice de répétition de la cellule
+    double lp_bound; // borne de la relaxation linéaire de l'instance
 } ResultEntry;
 
 typedef struct {
@@ -32,11 +37,63 @@ typedef struct {
     ResultEntry random_vns;
     ResultEntry genetic;
     ResultEntry hybrid;
+    double lp_bound; // borne de la relaxation linéaire, pour l'écart à l'optimum
 } ExperimentalResultsKSM;
 
 
 /**
- * @brief Mesure le temps CPU écoulé depuis le démarrage du programme.
+ * @brief Algorithme exécuté par une cellule de la grille d'expériences.
+ */
+typedef enum {
+    CELL_VNS,     ///< VNS (gloutonne ou aléatoire selon `initialization_function`).
+    CELL_GENETIC, ///< Algorithme génétique.
+    CELL_HYBRID   ///< Hybride GA + VNS.
+} BenchmarkCellKind;
+
+/**
+ * @brief Une cellule de la grille : une instance et une combinaison de paramètres.
+ */
+typedef struct {
+    BenchmarkCellKind kind;            ///< Algorithme à exécuter.
+    const KnapsackInstance *instance;  ///< Instance (possédée par la grille).
+    char filename[256];                ///< Nom de l'instance reporté dans le CSV.
+    const char *type;                  ///< Type reporté dans le CSV (vns_gloutonne, genetic, ...).
+    KnapsackSolution *(*initialization_function)(const KnapsackInstance *); ///< Construction initiale (VNS).
+    int temps_max;                     ///< Limite de temps en secondes (0 pour illimité).
+    int vns_iterations;                ///< Itérations de VNS.
+    int k_perturbation;                ///< Intensité de la perturbation.
+    int population_size;               ///< Taille de la population.
+    int generations;                   ///< Nombre de générations.
+    double mutation_rate;              ///< Taux de mutation.
+    int reported_time;                 ///< Si > 0, temps reporté à la place du temps CPU mesuré.
+} BenchmarkCell;
+
+/**
+ * @brief Grille d'expériences : instances chargées une seule fois et cellules à exécuter.
+ */
+typedef struct {
+    BenchmarkCell *cells;              ///< Cellules à exécuter.
+    int count;                         ///< Nombre de cellules.
+    int capacity;                      ///< Capacité du tableau de cellules.
+    KnapsackInstance **instances;      ///< Instances chargées (partagées en lecture par les cellules).
+    int instance_count;                ///< Nombre d'instances chargées.
+    int instance_capacity;             ///< Capacité du tableau d'instances.
+    int repetitions;                   ///< Nombre d'exécutions de chaque cellule.
+    unsigned long long seed;           ///< Graine de base des générateurs des cellules.
+} BenchmarkGrid;
+
+/**
+ * @brief Nombre de threads utilisés par les expériences (option `-j` de `sadm_bench`).
+ */
+extern int benchmark_thread_count;
+
+/**
+ * @brief Nombre de répétitions de chaque cellule (option `-r` de `sadm_bench`).
+ */
+extern int benchmark_repetitions;
+
+/**
+ * @brief Mesure le temps CPU consommé par le thread courant.
  *
  * @return Le temps CPU écoulé en secondes (type double).
  */
@@ -114,6 +171,9 @@ ExperimentalResultsKSM run_all_experiments(const KnapsackInstance *instance, int
 /**
  * @brief Affiche les résultats des expérimentations sous forme de tableau.
  *
+ * Chaque ligne indique l'écart de la solution à la borne de la relaxation linéaire
+ * (100 × (borne - valeur) / borne), qui majore l'écart à l'optimum.
+ *
  * @param results Les résultats expérimentaux à afficher (de type `ExperimentalResultsKSM`).
  */
 void print_results_table(const ExperimentalResultsKSM *results);
@@ -128,6 +188,52 @@ void print_results_table(const ExperimentalResultsKSM *results);
  */
 void export_csv(ResultEntry *results, int data_index, const char *filename);
 
+/**
+ * @brief Initialise une grille vide (répétitions et graine issues des réglages globaux).
+ *
+ * @param grid Grille à initialiser.
+ */
+void benchmark_grid_init(BenchmarkGrid *grid);
+
+/**
+ * @brief Charge une instance dont la grille devient propriétaire.
+ *
+ * @param grid Grille concernée.
+ * @param path Chemin du fichier d'instance.
+ * @return L'instance chargée, valide jusqu'à `benchmark_grid_free`.
+ */
+const KnapsackInstance *benchmark_grid_load_instance(BenchmarkGrid *grid, const char *path);
+
+/**
+ * @brief Ajoute une cellule (initialisée à zéro) à la grille.
+ *
+ * @param grid Grille concernée.
+ * @return La cellule ajoutée, à remplir par l'appelant.
+ */
+BenchmarkCell *benchmark_grid_add_cell(BenchmarkGrid *grid);
+
+/**
+ * @brief Exécute toutes les cellules de la grille sur un pool de threads à vol de travail.
+ *
+ * Chaque cellule (et chaque répétition) est une tâche du pool ; un thread inoccupé vole
+ * les cellules en attente des autres. Les temps CPU (du thread) et réel sont mesurés par
+ * cellule, et chaque résultat est ajouté au fichier CSV dès que la cellule se termine :
+ * les lignes apparaissent donc dans l'ordre de fin d'exécution.
+ *
+ * @param grid Grille à exécuter.
+ * @param thread_count Nombre de threads du pool.
+ * @param csv_filename Fichier CSV de sortie (écrasé).
+ * @return 0 en cas de succès, 1 en cas d'erreur.
+ */
+int run_benchmark_grid(BenchmarkGrid *grid, int thread_count, const char *csv_filename);
+
+/**
+ * @brief Libère les cellules et les instances d'une grille.
+ *
+ * @param grid Grille à libérer.
+ */
+void benchmark_grid_free(BenchmarkGrid *grid);
+
 /**
  * @brief Exécute les algorithmes VNS Gloutonne et VNS Aléatoire sur un répertoire d'instances de sac à dos.
  *
@@ -225,4 +331,19 @@ int run_hybrid_algorithm_test(const char *repertoire, int population_size, int g
  * @return 0 en cas de succès, 1 en cas d'erreur.
  */
 int hybrid_vs_genetic_test(const char *repertoire, int population_size, int generations, double mutation_rate, int vns_iterations, int k_perturbation, int temps_max);
+
+/**
+ * @brief Vérifie que le portefeuille déterministe donne le même résultat sur 1 et sur N threads.
+ *
+ * Le portefeuille est exécuté deux fois avec la même graine et le même nombre d'époques,
+ * une fois sur un seul thread et une fois sur `thread_count` threads ; la valeur et le
+ * vecteur de sélection des deux meilleures solutions doivent être identiques bit à bit.
+ *
+ * @param path_instance Chemin du fichier d'instance.
+ * @param thread_count Nombre de threads de la seconde exécution.
+ * @param seed Graine commune aux deux exécutions.
+ * @return 0 si les deux exécutions sont identiques, 1 sinon.
+ */
+int verify_deterministic_portfolio(const char *path_instance, int thread_count, unsigned long long seed);
+
 #endif // BENCHMARK_H
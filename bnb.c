@@ -0,0 +1,307 @@
+#include "bnb.h"
+#include <string.h>
+#include <math.h>
+
+#define BNB_EPSILON 1e-6
+
+// État partagé par toutes les tâches de la recherche
+typedef struct {
+    const KnapsackInstance *instance;
+    const BnbConfig *config;
+    TimeValue start;
+    pthread_mutex_t lock;   // Protège best et open_bound
+    KnapsackSolution *best;
+    atomic_int incumbent;   // Valeur de best, lue sans verrou pour élaguer
+    atomic_long nodes;
+    atomic_int stopped;     // 1 dès qu'une limite ou la cible est atteinte
+    int target;             // Cible du thread appelant (0 : aucune), les tâches tournant sur d'autres threads
+    double open_bound;      // Plus grande borne d'un nœud laissé inexploré
+} BnbSearch;
+
+// Sous-arbre confié au pool
+typedef struct {
+    BnbSearch *search;
+    int *fixed;
+    double parent_bound;
+} BnbTask;
+
+BnbConfig default_bnb_config(void)
+{
+    BnbConfig config;
+    config.node_limit = 0;
+    config.time_limit = 0;
+    config.vns_iterations = 1000;
+    config.initial = NULL;
+    config.pool = NULL;
+    return config;
+}
+
+// Une borne réelle n'améliore la meilleure solution que si sa partie entière la dépasse
+static int can_improve(BnbSearch *search, double bound)
+{
+    return (int)floor(bound + BNB_EPSILON) > atomic_load(&search->incumbent);
+}
+
+static void record_open_node(BnbSearch *search, double bound)
+{
+    pthread_mutex_lock(&search->lock);
+    if (bound > search->open_bound)
+    {
+        search->open_bound = bound;
+    }
+    pthread_mutex_unlock(&search->lock);
+}
+
+static void offer_solution(BnbSearch *search, const double *x)
+{
+    int n = search->instance->n;
+    int Z = 0;
+    for (int i = 0; i < n; i++)
+    {
+        Z += x[i] > 0.5 ? search->instance->profits[i] : 0;
+    }
+    pthread_mutex_lock(&search->lock);
+    if (Z > search->best->Z)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            search->best->x[i] = x[i] > 0.5;
+        }
+        search->best->Z = Z;
+        atomic_store(&search->incumbent, Z);
+        if (search->target > 0 && Z >= search->target)
+        {
+            // Cible atteinte : toutes les tâches s'arrêtent
+            atomic_store(&search->stopped, 1);
+        }
+    }
+    pthread_mutex_unlock(&search->lock);
+}
+
+static int limits_reached(BnbSearch *search)
+{
+    if (atomic_load(&search->stopped))
+    {
+        return 1;
+    }
+    const BnbConfig *config = search->config;
+    if ((config->node_limit > 0 && atomic_load(&search->nodes) >= config->node_limit) || time_exceeded(search->start, config->time_limit) ||
+        (search->target > 0 && atomic_load(&search->incumbent) >= search->target))
+    {
+        atomic_store(&search->stopped, 1);
+        return 1;
+    }
+    return 0;
+}
+
+static void bnb_task(void *arg);
+
+// Sous-arbre des objets encore libres de `fixed` (restauré en sortie)
+static void explore(BnbSearch *search, int *fixed, double parent_bound)
+{
+    if (!can_improve(search, parent_bound))
+    {
+        return;
+    }
+    if (limits_reached(search))
+    {
+        record_open_node(search, parent_bound);
+        return;
+    }
+
+    const KnapsackInstance *instance = search->instance;
+    int n = instance->n;
+    LpRelaxation lp;
+    int solved = lp_solve(instance, fixed, &lp) == 0;
+    atomic_fetch_add(&search->nodes, 1);
+    if (lp.status == LP_INFEASIBLE || (solved && !can_improve(search, lp.bound)))
+    {
+        lp_free(&lp);
+        return;
+    }
+    double bound = solved ? lp.bound : parent_bound;
+
+    // Objet de séparation : le plus fractionnaire (le premier libre si le simplexe a échoué)
+    int branch = -1;
+    double distance = 1.0;
+    for (int i = 0; i < n; i++)
+    {
+        if (fixed[i] >= 0)
+        {
+            continue;
+        }
+        double d = solved ? fabs(lp.x[i] - 0.5) : 0.0;
+        if (d < 0.5 - BNB_EPSILON && d < distance)
+        {
+            branch = i;
+            distance = d;
+        }
+    }
+    if (branch < 0)
+    {
+        // Relaxation entière : solution réalisable, le nœud est résolu
+        if (solved)
+        {
+            offer_solution(search, lp.x);
+        }
+        lp_free(&lp);
+        return;
+    }
+
+    // Fixation par coûts réduits : inverser l'objet ferait passer la borne sous le seuil
+    int *changed = (int *)malloc(n * sizeof(int));
+    if (!changed)
+    {
+        perror("Erreur d'allocation mémoire (explore)");
+        exit(EXIT_FAILURE);
+    }
+    int changed_count = 0;
+    if (solved)
+    {
+        int threshold = atomic_load(&search->incumbent);
+        for (int i = 0; i < n; i++)
+        {
+            double rc = lp.reduced_costs[i];
+            if (fixed[i] >= 0 || i == branch || fabs(rc) < BNB_EPSILON || (int)floor(bound - fabs(rc) + BNB_EPSILON) > threshold)
+            {
+                continue;
+            }
+            fixed[i] = rc > 0 ? 1 : 0;
+            changed[changed_count++] = i;
+        }
+    }
+    int first = solved && lp.x[branch] >= 0.5 ? 1 : 0;
+    lp_free(&lp);
+
+    // Second fils confié au pool tant que ses files sont peu remplies
+    ThreadPool *pool = search->config->pool;
+    int spawned = 0;
+    if (pool != NULL && atomic_load(&pool->queued) < 2 * pool->thread_count)
+    {
+        BnbTask *task = (BnbTask *)malloc(sizeof(BnbTask));
+        int *copy = (int *)malloc(n * sizeof(int));
+        if (task && copy)
+        {
+            memcpy(copy, fixed, n * sizeof(int));
+            copy[branch] = 1 - first;
+            task->search = search;
+            task->fixed = copy;
+            task->parent_bound = bound;
+            thread_pool_submit(pool, bnb_task, task);
+            spawned = 1;
+        }
+        else
+        {
+            free(task);
+            free(copy);
+        }
+    }
+
+    fixed[branch] = first;
+    explore(search, fixed, bound);
+    if (!spawned)
+    {
+        fixed[branch] = 1 - first;
+        explore(search, fixed, bound);
+    }
+
+    fixed[branch] = -1;
+    for (int c = 0; c < changed_count; c++)
+    {
+        fixed[changed[c]] = -1;
+    }
+    free(changed);
+}
+
+static void bnb_task(void *arg)
+{
+    BnbTask *task = (BnbTask *)arg;
+    explore(task->search, task->fixed, task->parent_bound);
+    free(task->fixed);
+    free(task);
+}
+
+void bnb_solve(const KnapsackInstance *instance, const BnbConfig *config, BnbResult *result)
+{
+    int n = instance->n;
+    memset(result, 0, sizeof(BnbResult));
+
+    BnbSearch search;
+    search.instance = instance;
+    search.config = config;
+    search.start = get_current_time();
+    pthread_mutex_init(&search.lock, NULL);
+    atomic_init(&search.nodes, 0);
+    atomic_init(&search.stopped, 0);
+    search.target = termination_target();
+    search.open_bound = -1.0;
+
+    // Solution initiale : fournie, ou glouton amélioré par VNS (au plus la moitié du temps) ; glouton dual s'il est meilleur
+    if (config->initial != NULL)
+    {
+        search.best = init_solution(n);
+        copy_solution_into(search.best, config->initial, n);
+    }
+    else
+    {
+        search.best = greedy_initial_solution(instance);
+        variable_neighborhood_search_budget(search.best, instance, config->vns_iterations, 2, search.start, config->time_limit / 2);
+    }
+    KnapsackSolution *dual = greedy_dual_solution(instance);
+    if (dual->Z > search.best->Z)
+    {
+        copy_solution_into(search.best, dual, n);
+    }
+    free_solution(dual);
+    atomic_init(&search.incumbent, search.best->Z);
+
+    result->root_bound = lp_upper_bound(instance);
+    int *fixed = (int *)malloc(n * sizeof(int));
+    if (!fixed)
+    {
+        perror("Erreur d'allocation mémoire (bnb_solve)");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < n; i++)
+    {
+        fixed[i] = -1;
+    }
+    // Sans relaxation, la somme des profits borne la racine
+    double root = result->root_bound;
+    if (root < 0)
+    {
+        root = 0;
+        for (int i = 0; i < n; i++)
+        {
+            root += instance->profits[i];
+        }
+    }
+    explore(&search, fixed, root);
+    if (config->pool != NULL)
+    {
+        thread_pool_wait(config->pool);
+    }
+    free(fixed);
+    // Temps d'atteinte enregistré pour le thread appelant
+    target_reached(search.best->Z);
+
+    result->best = search.best;
+    result->nodes = atomic_load(&search.nodes);
+    result->bound = search.best->Z;
+    if ((int)floor(search.open_bound + BNB_EPSILON) > result->bound)
+    {
+        result->bound = (int)floor(search.open_bound + BNB_EPSILON);
+    }
+    result->optimal = result->bound == result->best->Z;
+    result->gap = result->bound > 0 ? 100.0 * (result->bound - result->best->Z) / result->bound : 0.0;
+    pthread_mutex_destroy(&search.lock);
+}
+
+void bnb_free(BnbResult *result)
+{
+    if (result->best)
+    {
+        free_solution(result->best);
+    }
+    result->best = NULL;
+}
@@ -0,0 +1,71 @@
+#ifndef BNB_H
+#define BNB_H
+
+#include "lp.h"
+#include "thread_pool.h"
+
+/**
+ * @brief Paramètres de la séparation et évaluation (branch-and-bound) exacte.
+ *
+ * L'arbre est parcouru en profondeur d'abord. Chaque nœud résout la relaxation linéaire
+ * avec les objets déjà fixés (`lp_solve`) ; il est élagué si la partie entière de sa borne
+ * ne dépasse pas la meilleure solution connue. Sinon, les coûts réduits fixent les objets
+ * dont l'inversion ferait passer la borne sous ce seuil, puis le nœud est séparé sur
+ * l'objet le plus fractionnaire (d'abord du côté de l'arrondi de sa valeur LP).
+ */
+typedef struct {
+    long node_limit;    ///< Nombre maximal de relaxations résolues (0 pour illimité).
+    double time_limit;  ///< Durée maximale en secondes (0 pour illimité).
+    int vns_iterations; ///< Itérations de la VNS qui améliore la solution initiale gloutonne (au plus la moitié de `time_limit`).
+    const KnapsackSolution *initial; ///< Solution de départ réalisable (`NULL` : glouton amélioré par VNS).
+    ThreadPool *pool;   ///< Pool pour explorer des sous-arbres en parallèle (`NULL` : séquentiel).
+} BnbConfig;
+
+/**
+ * @brief Résultat de la séparation et évaluation.
+ */
+typedef struct {
+    KnapsackSolution *best; ///< Meilleure solution trouvée.
+    int bound;              ///< Borne supérieure prouvée (égale à `best->Z` si `optimal`).
+    double root_bound;      ///< Borne LP de la racine.
+    double gap;             ///< Écart (bound - best->Z) / bound, en pourcentage.
+    long nodes;             ///< Nombre de relaxations résolues.
+    int optimal;            ///< 1 si l'arbre a été entièrement exploré (optimum prouvé).
+} BnbResult;
+
+/**
+ * @brief Retourne la configuration par défaut (sans limite, VNS de 1000 itérations, séquentiel).
+ *
+ * @return La configuration par défaut.
+ */
+BnbConfig default_bnb_config(void);
+
+/**
+ * @brief Résout l'instance exactement, ou jusqu'à la limite de nœuds ou de temps, ou jusqu'à la cible.
+ *
+ * La solution initiale est la meilleure de `config->initial` (à défaut, du glouton
+ * `greedy_initial_solution` amélioré par VNS) et du glouton dual (`greedy_dual_solution`).
+ * Avec un pool, un nœud confie son second fils à une nouvelle tâche tant que les files du
+ * pool sont peu remplies ; les threads inoccupés volent ces sous-arbres. La meilleure
+ * solution est partagée sous verrou et sa valeur lue sans verrou pour élaguer.
+ *
+ * En cas d'arrêt anticipé, la borne prouvée est le maximum de la meilleure valeur et des
+ * bornes (partie entière) des nœuds laissés inexplorés : `bound` majore toujours l'optimum
+ * et `gap` mesure la distance restante.
+ * La cible du thread appelant (`termination.h`) est lue au départ et vaut pour toutes les
+ * tâches ; son temps d'atteinte est enregistré pour le thread appelant à la fin de la recherche.
+ *
+ * @param instance Instance du problème.
+ * @param config Paramètres de la recherche.
+ * @param result Résultat, alloué par la fonction (à libérer avec `bnb_free`).
+ */
+void bnb_solve(const KnapsackInstance *instance, const BnbConfig *config, BnbResult *result);
+
+/**
+ * @brief Libère le résultat d'une séparation et évaluation.
+ *
+ * @param result Résultat à libérer.
+ */
+void bnb_free(BnbResult *result);
+
+#endif // BNB_H
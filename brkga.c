@@ -0,0 +1,231 @@
+#include "brkga.h"
+#include <string.h>
+
+// Population stockée en tableaux contigus : une ligne de n clés / n objets par chromosome
+typedef struct {
+    float *keys;
+    int *x;
+    int *Z;
+} BrkgaPopulation;
+
+typedef struct {
+    const KnapsackInstance *instance;
+    BrkgaPopulation *population;
+    int first;    // Premier chromosome à décoder
+    int *orders;  // Tampon de tri, une ligne par chromosome
+    int *loads;   // Charges, une ligne par chromosome
+} DecodeBatch;
+
+// Clés et valeurs de référence pour qsort (propres à chaque thread)
+static _Thread_local const float *decode_keys = NULL;
+static _Thread_local const int *ranking_values = NULL;
+
+static int compare_keys(const void *a, const void *b)
+{
+    float ka = decode_keys[*(const int *)a];
+    float kb = decode_keys[*(const int *)b];
+    if (ka != kb)
+    {
+        return (ka > kb) - (ka < kb);
+    }
+    return *(const int *)a - *(const int *)b;
+}
+
+// Valeur décroissante, puis indice croissant (tri déterministe)
+static int compare_ranking(const void *a, const void *b)
+{
+    int za = ranking_values[*(const int *)a];
+    int zb = ranking_values[*(const int *)b];
+    if (za != zb)
+    {
+        return (za < zb) - (za > zb);
+    }
+    return *(const int *)a - *(const int *)b;
+}
+
+BrkgaConfig default_brkga_config(void)
+{
+    BrkgaConfig config;
+    config.population_size = 200;
+    config.elite_fraction = 0.2;
+    config.mutant_fraction = 0.15;
+    config.elite_bias = 0.7;
+    config.generations = 1000;
+    config.seed = 1;
+    config.pool = NULL;
+    return config;
+}
+
+// Décodeur glouton : objets par clé croissante, ajoutés s'ils tiennent (test en O(m))
+static void decode_chromosome(void *arg, int index)
+{
+    DecodeBatch *batch = (DecodeBatch *)arg;
+    const KnapsackInstance *instance = batch->instance;
+    int c = batch->first + index;
+    const float *keys = &batch->population->keys[(size_t)c * instance->n];
+    int *x = &batch->population->x[(size_t)c * instance->n];
+    int *order = &batch->orders[(size_t)c * instance->n];
+    int *load = &batch->loads[(size_t)c * instance->m];
+
+    for (int i = 0; i < instance->n; i++)
+    {
+        order[i] = i;
+        x[i] = 0;
+    }
+    decode_keys = keys;
+    qsort(order, instance->n, sizeof(int), compare_keys);
+
+    for (int k = 0; k < instance->m; k++)
+    {
+        load[k] = 0;
+    }
+    int Z = 0;
+    for (int r = 0; r < instance->n; r++)
+    {
+        int i = order[r];
+        int fits = 1;
+        for (int k = 0; k < instance->m && fits; k++)
+        {
+            fits = load[k] + instance->weights[k][i] <= instance->capacities[k];
+        }
+        if (fits)
+        {
+            x[i] = 1;
+            Z += instance->profits[i];
+            for (int k = 0; k < instance->m; k++)
+            {
+                load[k] += instance->weights[k][i];
+            }
+        }
+    }
+    batch->population->Z[c] = Z;
+}
+
+static int alloc_brkga_population(BrkgaPopulation *population, int size, int n)
+{
+    population->keys = (float *)malloc((size_t)size * n * sizeof(float));
+    population->x = (int *)malloc((size_t)size * n * sizeof(int));
+    population->Z = (int *)malloc(size * sizeof(int));
+    return (!population->keys || !population->x || !population->Z) ? -1 : 0;
+}
+
+static void free_brkga_population(BrkgaPopulation *population)
+{
+    free(population->keys);
+    free(population->x);
+    free(population->Z);
+}
+
+static void copy_chromosome(BrkgaPopulation *dest, int d, const BrkgaPopulation *src, int s, int n)
+{
+    memcpy(&dest->keys[(size_t)d * n], &src->keys[(size_t)s * n], n * sizeof(float));
+    memcpy(&dest->x[(size_t)d * n], &src->x[(size_t)s * n], n * sizeof(int));
+    dest->Z[d] = src->Z[s];
+}
+
+KnapsackSolution *brkga_search(const KnapsackInstance *instance, const BrkgaConfig *config, double time_limit)
+{
+    TimeValue start = get_current_time();
+    int size = config->population_size;
+    int n = instance->n;
+    int elite = (int)(config->elite_fraction * size);
+    int mutants = (int)(config->mutant_fraction * size);
+    if (elite < 1)
+    {
+        elite = 1;
+    }
+    if (elite + mutants >= size)
+    {
+        mutants = size - elite - 1 > 0 ? size - elite - 1 : 0;
+    }
+
+    RngState rng;
+    rng_seed(&rng, config->seed);
+
+    BrkgaPopulation buffers[2] = {{NULL, NULL, NULL}, {NULL, NULL, NULL}};
+    int *orders = (int *)malloc((size_t)size * n * sizeof(int));
+    int *loads = (int *)malloc((size_t)size * instance->m * sizeof(int));
+    int *ranking = (int *)malloc(size * sizeof(int));
+    KnapsackSolution *best = NULL;
+    if (alloc_brkga_population(&buffers[0], size, n) != 0 || alloc_brkga_population(&buffers[1], size, n) != 0 || !orders || !loads || !ranking)
+    {
+        perror("Erreur d'allocation mémoire (brkga_search)");
+        goto cleanup;
+    }
+
+    // Population initiale : clés uniformes, décodage de tous les chromosomes
+    BrkgaPopulation *current = &buffers[0];
+    BrkgaPopulation *next = &buffers[1];
+    for (size_t i = 0; i < (size_t)size * n; i++)
+    {
+        current->keys[i] = (float)rng_double(&rng);
+    }
+    DecodeBatch batch = {instance, current, 0, orders, loads};
+    thread_pool_parallel_for(config->pool, size, decode_chromosome, &batch);
+
+    for (int gen = 0; gen < config->generations && !time_exceeded(start, time_limit); gen++)
+    {
+        for (int c = 0; c < size; c++)
+        {
+            ranking[c] = c;
+        }
+        ranking_values = current->Z;
+        qsort(ranking, size, sizeof(int), compare_ranking);
+        if (target_reached(current->Z[ranking[0]]))
+        {
+            break;
+        }
+
+        // Élite recopiée (déjà décodée)
+        for (int e = 0; e < elite; e++)
+        {
+            copy_chromosome(next, e, current, ranking[e], n);
+        }
+        // Mutants : nouvelles clés aléatoires
+        for (size_t i = (size_t)elite * n; i < (size_t)(elite + mutants) * n; i++)
+        {
+            next->keys[i] = (float)rng_double(&rng);
+        }
+        // Enfants : chaque clé vient du parent élite avec probabilité elite_bias
+        for (int c = elite + mutants; c < size; c++)
+        {
+            const float *elite_keys = &current->keys[(size_t)ranking[rng_int(&rng, elite)] * n];
+            const float *other_keys = &current->keys[(size_t)ranking[elite + rng_int(&rng, size - elite)] * n];
+            float *child = &next->keys[(size_t)c * n];
+            for (int i = 0; i < n; i++)
+            {
+                child[i] = rng_double(&rng) < config->elite_bias ? elite_keys[i] : other_keys[i];
+            }
+        }
+
+        // Décodage des nouveaux chromosomes, indépendants les uns des autres
+        batch.population = next;
+        batch.first = elite;
+        thread_pool_parallel_for(config->pool, size - elite, decode_chromosome, &batch);
+
+        BrkgaPopulation *swap = current;
+        current = next;
+        next = swap;
+    }
+
+    // L'élite étant conservée, la meilleure solution est dans la population courante
+    int best_index = 0;
+    for (int c = 1; c < size; c++)
+    {
+        if (current->Z[c] > current->Z[best_index])
+        {
+            best_index = c;
+        }
+    }
+    best = init_solution(n);
+    memcpy(best->x, &current->x[(size_t)best_index * n], n * sizeof(int));
+    best->Z = current->Z[best_index];
+
+cleanup:
+    free_brkga_population(&buffers[0]);
+    free_brkga_population(&buffers[1]);
+    free(orders);
+    free(loads);
+    free(ranking);
+    return best;
+}
@@ -0,0 +1,49 @@
+#ifndef BRKGA_H
+#define BRKGA_H
+
+#include "heuristique.h"
+#include "thread_pool.h"
+
+/**
+ * @brief Paramètres de l'algorithme génétique à clés aléatoires biaisées (BRKGA).
+ *
+ * Un chromosome est un vecteur de `n` clés réelles dans [0, 1[. Le décodeur insère les
+ * objets par clé croissante, chacun seulement s'il tient dans les capacités restantes
+ * (test en O(m)) : tout chromosome donne une solution faisable et maximale, sans réparation.
+ *
+ * À chaque génération, la population est triée par valeur et découpée en trois parts :
+ * l'élite (recopiée telle quelle), les mutants (clés tirées au hasard) et les enfants,
+ * dont chaque clé vient du parent élite avec probabilité `elite_bias`.
+ */
+typedef struct {
+    int population_size;    ///< Nombre de chromosomes.
+    double elite_fraction;  ///< Part de l'élite dans la population.
+    double mutant_fraction; ///< Part des mutants dans la population.
+    double elite_bias;      ///< Probabilité d'hériter une clé du parent élite.
+    int generations;        ///< Nombre maximal de générations.
+    unsigned long long seed; ///< Graine du générateur propre à la recherche.
+    ThreadPool *pool;       ///< Pool pour décoder la population en parallèle (`NULL` : séquentiel).
+} BrkgaConfig;
+
+/**
+ * @brief Retourne la configuration par défaut du BRKGA (paramètres usuels de Gonçalves et Resende).
+ *
+ * @return Une configuration avec 20 % d'élite, 15 % de mutants et un biais de 0.7.
+ */
+BrkgaConfig default_brkga_config(void);
+
+/**
+ * @brief Exécute le BRKGA jusqu'au nombre de générations ou à l'échéance.
+ *
+ * Les clés sont tirées séquentiellement avec le générateur de la recherche ; seul le
+ * décodage, indépendant d'un chromosome à l'autre, est réparti sur le pool. Le résultat
+ * ne dépend donc que de la graine, pas du nombre de threads (sauf arrêt sur échéance).
+ *
+ * @param instance Instance du problème.
+ * @param config Paramètres de l'algorithme.
+ * @param time_limit Durée maximale en secondes (0 pour illimité), vérifiée entre deux générations.
+ * @return La meilleure solution trouvée (à libérer avec `free_solution`), ou `NULL` en cas d'erreur.
+ */
+KnapsackSolution *brkga_search(const KnapsackInstance *instance, const BrkgaConfig *config, double time_limit);
+
+#endif // BRKGA_H
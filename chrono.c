@@ -1,15 +1,15 @@
 #include "chrono.h"
 
-jmp_buf env;
-volatile sig_atomic_t timeout_flag = 0;
+_Thread_local jmp_buf env;
+_Thread_local volatile sig_atomic_t timeout_flag = 0;
 
 /**
  * @brief Stocke le temps de départ de la mesure.
  */
  #ifdef _WIN32
- LARGE_INTEGER start_time;
+ _Thread_local LARGE_INTEGER start_time;
  #else
- struct timespec start_time;
+ _Thread_local struct timespec start_time;
  #endif // _WIN32
  
 
@@ -43,3 +43,25 @@ void check_timeout(TimeValue start_time, double time_limit_seconds) {
         longjmp(env, 1); 
     }
 }
+
+int time_exceeded(TimeValue start_time, double time_limit_seconds) {
+    if (time_limit_seconds <= 0) {
+        return 0;
+    }
+    return get_elapsed_time(start_time, get_current_time()) > time_limit_seconds;
+}
+
+double get_thread_cpu_time(void) {
+#ifdef _WIN32
+    FILETIME creation_time, exit_time, kernel_time, user_time;
+    GetThreadTimes(GetCurrentThread(), &creation_time, &exit_time, &kernel_time, &user_time);
+    ULARGE_INTEGER user;
+    user.LowPart = user_time.dwLowDateTime;
+    user.HighPart = user_time.dwHighDateTime;
+    return (double)user.QuadPart / 1e7; // Unités de 100 ns
+#else
+    struct timespec time;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+    return time.tv_sec + time.tv_nsec / 1e9;
+#endif
+}
@@ -15,21 +15,24 @@
 
 /**
  * @brief Buffer de saut utilisé pour gérer le timeout avec longjmp.
+ *
+ * Propre à chaque thread, comme `timeout_flag` et `start_time` : plusieurs algorithmes
+ * avec limite de temps peuvent ainsi s'exécuter en parallèle.
  */
-extern jmp_buf env; 
+extern _Thread_local jmp_buf env; 
 
 /**
  * @brief Drapeau indiquant si un timeout a été atteint.
  */
-extern volatile sig_atomic_t timeout_flag;
+extern _Thread_local volatile sig_atomic_t timeout_flag;
 
 /**
  * @brief Stocke le temps de départ de la mesure.
  */
  #ifdef _WIN32
- extern LARGE_INTEGER start_time;
+ extern _Thread_local LARGE_INTEGER start_time;
  #else
- extern struct timespec start_time;
+ extern _Thread_local struct timespec start_time;
  #endif // _WIN32
  
 
@@ -66,4 +69,26 @@ double get_elapsed_time(TimeValue start_time, TimeValue end_time);
  */
 void check_timeout(TimeValue start_time, double time_limit_seconds);
 
+/**
+ * @brief Indique si le temps écoulé depuis `start_time` dépasse une limite, sans déclencher de `longjmp`.
+ *
+ * Variante coopérative de `check_timeout` : l'appelant décide lui-même comment s'arrêter,
+ * ce qui permet de l'utiliser depuis plusieurs threads ou entre deux pas d'un solveur.
+ *
+ * @param start_time Temps de départ de la mesure.
+ * @param time_limit_seconds Durée maximale autorisée en secondes (0 ou moins pour illimité).
+ * @return 1 si la limite est dépassée, 0 sinon.
+ */
+int time_exceeded(TimeValue start_time, double time_limit_seconds);
+
+/**
+ * @brief Mesure le temps CPU consommé par le thread courant.
+ *
+ * Contrairement à `clock()`, qui cumule le temps de tous les threads du processus,
+ * cette mesure reste juste lorsque plusieurs expériences s'exécutent en parallèle.
+ *
+ * @return Le temps CPU du thread courant en secondes.
+ */
+double get_thread_cpu_time(void);
+
 #endif // CHRONO_H
\ No newline at end of file
@@ -0,0 +1,184 @@
+#include "core.h"
+#include <string.h>
+#include <math.h>
+
+#define CORE_EPSILON 1e-6
+
+// |coût réduit| de référence pour qsort (propre à chaque thread)
+static _Thread_local const double *core_costs = NULL;
+
+// |coût réduit| croissant, puis indice croissant (tri déterministe)
+static int compare_costs(const void *a, const void *b)
+{
+    double ca = fabs(core_costs[*(const int *)a]);
+    double cb = fabs(core_costs[*(const int *)b]);
+    if (ca != cb)
+    {
+        return (ca > cb) - (ca < cb);
+    }
+    return *(const int *)a - *(const int *)b;
+}
+
+void reduced_cost_order(const double *reduced_costs, int *items, int count)
+{
+    core_costs = reduced_costs;
+    qsort(items, count, sizeof(int), compare_costs);
+    core_costs = NULL;
+}
+
+void restrict_problem(const KnapsackInstance *instance, const int *fixed, const int *order, ReducedProblem *reduced)
+{
+    int n = instance->n;
+    int m = instance->m;
+    int free_count = 0;
+    for (int i = 0; i < n; i++)
+    {
+        free_count += fixed[i] < 0;
+    }
+    memset(reduced, 0, sizeof(ReducedProblem));
+    reduced->original_n = n;
+    reduced->fixed = (int *)malloc(n * sizeof(int));
+    if (!reduced->fixed)
+    {
+        perror("Erreur d'allocation mémoire (restrict_problem)");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(reduced->fixed, fixed, n * sizeof(int));
+
+    KnapsackInstance *core = &reduced->core;
+    core->n = free_count;
+    core->m = m;
+    core->profits = (int *)malloc((free_count > 0 ? free_count : 1) * sizeof(int));
+    core->capacities = (int *)malloc(m * sizeof(int));
+    core->weights = (int **)malloc(m * sizeof(int *));
+    reduced->map = (int *)malloc((free_count > 0 ? free_count : 1) * sizeof(int));
+    if (!core->profits || !core->capacities || !core->weights || !reduced->map)
+    {
+        perror("Erreur d'allocation mémoire (restrict_problem)");
+        exit(EXIT_FAILURE);
+    }
+    int c = 0;
+    for (int r = 0; r < n; r++)
+    {
+        int i = order ? order[r] : r;
+        if (fixed[i] < 0)
+        {
+            reduced->map[c] = i;
+            core->profits[c++] = instance->profits[i];
+        }
+        else if (fixed[i] == 1)
+        {
+            reduced->fixed_profit += instance->profits[i];
+        }
+    }
+    for (int k = 0; k < m; k++)
+    {
+        core->weights[k] = (int *)malloc((free_count > 0 ? free_count : 1) * sizeof(int));
+        if (!core->weights[k])
+        {
+            perror("Erreur d'allocation mémoire (restrict_problem)");
+            exit(EXIT_FAILURE);
+        }
+        core->capacities[k] = instance->capacities[k];
+        for (int i = 0; i < n; i++)
+        {
+            if (fixed[i] == 1)
+            {
+                core->capacities[k] -= instance->weights[k][i];
+            }
+        }
+        for (int j = 0; j < free_count; j++)
+        {
+            core->weights[k][j] = instance->weights[k][reduced->map[j]];
+        }
+    }
+}
+
+int reduce_problem(const KnapsackInstance *instance, int incumbent, int core_size, ReducedProblem *reduced)
+{
+    int n = instance->n;
+    memset(reduced, 0, sizeof(ReducedProblem));
+
+    LpRelaxation lp;
+    if (lp_solve(instance, NULL, &lp) != 0)
+    {
+        lp_free(&lp);
+        return -1;
+    }
+    int *fixed = (int *)malloc(n * sizeof(int));
+    int *candidates = (int *)malloc(n * sizeof(int));
+    if (!fixed || !candidates)
+    {
+        perror("Erreur d'allocation mémoire (reduce_problem)");
+        exit(EXIT_FAILURE);
+    }
+
+    // Fixation sûre : inverser l'objet ferait passer la borne sous la solution connue
+    int free_count = 0;
+    int fixed_by_cost = 0;
+    int fixed_by_core = 0;
+    for (int i = 0; i < n; i++)
+    {
+        double rc = lp.reduced_costs[i];
+        fixed[i] = -1;
+        if (fabs(rc) > CORE_EPSILON && (int)floor(lp.bound - fabs(rc) + CORE_EPSILON) <= incumbent)
+        {
+            fixed[i] = rc > 0 ? 1 : 0;
+            fixed_by_cost++;
+        }
+        else
+        {
+            candidates[free_count++] = i;
+        }
+    }
+
+    // Cœur : les objets libres les plus proches de la frontière de la relaxation
+    if (core_size > 0 && free_count > core_size)
+    {
+        reduced_cost_order(lp.reduced_costs, candidates, free_count);
+        for (int r = core_size; r < free_count; r++)
+        {
+            int i = candidates[r];
+            fixed[i] = lp.x[i] > 1.0 - CORE_EPSILON ? 1 : 0;
+            fixed_by_core++;
+        }
+    }
+
+    // Instance cœur, objets par pseudo-utilité duale décroissante
+    int *order = dual_utility_order(instance, lp.duals);
+    restrict_problem(instance, fixed, order, reduced);
+    reduced->fixed_by_cost = fixed_by_cost;
+    reduced->fixed_by_core = fixed_by_core;
+    reduced->lp_bound = lp.bound;
+    free(order);
+    free(fixed);
+    free(candidates);
+    lp_free(&lp);
+    return 0;
+}
+
+KnapsackSolution *expand_solution(const ReducedProblem *reduced, const KnapsackSolution *core_solution)
+{
+    KnapsackSolution *solution = init_solution(reduced->original_n);
+    for (int i = 0; i < reduced->original_n; i++)
+    {
+        solution->x[i] = reduced->fixed[i] == 1;
+    }
+    for (int j = 0; j < reduced->core.n; j++)
+    {
+        solution->x[reduced->map[j]] = core_solution->x[j];
+    }
+    solution->Z = core_solution->Z + reduced->fixed_profit;
+    return solution;
+}
+
+void reduced_problem_free(ReducedProblem *reduced)
+{
+    if (reduced->core.weights)
+    {
+        free_knapsack_instance(&reduced->core);
+    }
+    free(reduced->map);
+    free(reduced->fixed);
+    memset(reduced, 0, sizeof(ReducedProblem));
+}
@@ -0,0 +1,85 @@
+#ifndef CORE_H
+#define CORE_H
+
+#include "lp.h"
+
+/**
+ * @brief Problème réduit à son cœur, avec la correspondance vers l'instance d'origine.
+ *
+ * Les objets fixés sont retirés : le cœur ne garde que les objets libres, ordonnés par
+ * pseudo-utilité duale décroissante, et ses capacités sont diminuées des poids des objets
+ * fixés à 1. Une solution du cœur vaut `fixed_profit` de moins que la solution complète
+ * correspondante (`expand_solution`).
+ */
+typedef struct {
+    KnapsackInstance core; ///< Instance du cœur (à ne pas libérer séparément).
+    int original_n;        ///< Nombre d'objets de l'instance d'origine.
+    int *map;              ///< Indice d'origine de chaque objet du cœur (`core.n` valeurs).
+    int *fixed;            ///< Valeur de chaque objet d'origine (-1 : dans le cœur, 0 ou 1 : fixé).
+    int fixed_profit;      ///< Somme des profits des objets fixés à 1.
+    int fixed_by_cost;     ///< Objets fixés par coûts réduits (fixation sûre).
+    int fixed_by_core;     ///< Objets fixés parce qu'ils sont hors du cœur (fixation heuristique).
+    double lp_bound;       ///< Borne LP de l'instance d'origine.
+} ReducedProblem;
+
+/**
+ * @brief Trie des objets par |coût réduit| croissant, puis par indice croissant.
+ *
+ * Les premiers objets sont les plus proches de la frontière de la relaxation.
+ *
+ * @param reduced_costs Coûts réduits de la relaxation (indexés par objet).
+ * @param items Indices des objets à trier (modifiés en place).
+ * @param count Nombre d'indices.
+ */
+void reduced_cost_order(const double *reduced_costs, int *items, int count);
+
+/**
+ * @brief Construit le problème restreint aux objets libres d'une fixation quelconque.
+ *
+ * Les capacités sont diminuées des poids des objets fixés à 1 (qui doivent tenir ensemble,
+ * par exemple parce qu'ils sont fixés à leur valeur dans une solution réalisable).
+ *
+ * @param instance Instance d'origine.
+ * @param fixed Valeur de chaque objet (-1 : libre, 0 ou 1 : fixé), copiée.
+ * @param order Ordre des objets du problème restreint (`n` indices, seuls les libres sont retenus), ou `NULL` pour l'ordre des indices.
+ * @param reduced Problème restreint, alloué par la fonction (à libérer avec `reduced_problem_free`) ;
+ *                les compteurs de fixation et la borne LP sont laissés à 0.
+ */
+void restrict_problem(const KnapsackInstance *instance, const int *fixed, const int *order, ReducedProblem *reduced);
+
+/**
+ * @brief Fixe des objets par coûts réduits, puis restreint le problème à un cœur.
+ *
+ * Si la borne LP diminuée de |coût réduit| d'un objet ne dépasse pas `incumbent`, toute
+ * solution qui inverse cet objet par rapport à la relaxation est au mieux aussi bonne que
+ * la solution connue : l'objet est fixé à sa valeur LP sans perdre de solution améliorante.
+ * Si `core_size` est positif, seuls les `core_size` objets libres de plus petit |coût réduit|
+ * (dont tous les objets fractionnaires) restent libres ; les autres sont fixés à leur valeur
+ * LP, ce qui peut exclure l'optimum. Les objets fixés à 1 valent 1 dans la relaxation :
+ * leurs poids tiennent toujours dans les capacités.
+ *
+ * @param instance Instance d'origine.
+ * @param incumbent Valeur d'une solution réalisable connue (0 si aucune).
+ * @param core_size Nombre maximal d'objets libres (0 : seulement la fixation sûre).
+ * @param reduced Problème réduit, alloué par la fonction (à libérer avec `reduced_problem_free`).
+ * @return 0 en cas de succès, -1 si la relaxation n'a pas pu être résolue (rien n'est alloué).
+ */
+int reduce_problem(const KnapsackInstance *instance, int incumbent, int core_size, ReducedProblem *reduced);
+
+/**
+ * @brief Reconstruit la solution complète correspondant à une solution du cœur.
+ *
+ * @param reduced Problème réduit.
+ * @param core_solution Solution du cœur (`reduced->core.n` objets).
+ * @return La solution complète, évaluée (à libérer avec `free_solution`).
+ */
+KnapsackSolution *expand_solution(const ReducedProblem *reduced, const KnapsackSolution *core_solution);
+
+/**
+ * @brief Libère un problème réduit et son instance cœur.
+ *
+ * @param reduced Problème réduit à libérer.
+ */
+void reduced_problem_free(ReducedProblem *reduced);
+
+#endif // CORE_H
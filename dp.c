@@ -0,0 +1,98 @@
+#include "dp.h"
+#include <string.h>
+#include <stdint.h>
+
+// Capacité utile d'une contrainte : au plus la somme de ses poids
+static int useful_capacity(const KnapsackInstance *instance, int k)
+{
+    long long total = 0;
+    for (int i = 0; i < instance->n; i++)
+    {
+        total += instance->weights[k][i];
+    }
+    return total < instance->capacities[k] ? (int)total : instance->capacities[k];
+}
+
+size_t dp_memory_estimate(const KnapsackInstance *instance)
+{
+    if (instance->m > 2 || instance->m < 1)
+    {
+        return 0;
+    }
+    size_t rows = (size_t)useful_capacity(instance, 0) + 1;
+    size_t columns = instance->m == 2 ? (size_t)useful_capacity(instance, 1) + 1 : 1;
+    size_t cells = rows * columns;
+    size_t words = (cells + 63) / 64;
+    return cells * sizeof(int) + (size_t)instance->n * words * sizeof(uint64_t);
+}
+
+KnapsackSolution *dp_solve(const KnapsackInstance *instance, size_t memory_limit)
+{
+    size_t needed = dp_memory_estimate(instance);
+    if (needed == 0 || needed > memory_limit)
+    {
+        return NULL;
+    }
+
+    int n = instance->n;
+    int rows = useful_capacity(instance, 0) + 1;
+    int columns = instance->m == 2 ? useful_capacity(instance, 1) + 1 : 1;
+    size_t cells = (size_t)rows * columns;
+    size_t words = (cells + 63) / 64;
+    int *best = (int *)calloc(cells, sizeof(int));
+    uint64_t *taken = (uint64_t *)calloc((size_t)n * words, sizeof(uint64_t));
+    if (!best || !taken)
+    {
+        // La borne mémoire n'est pas disponible : l'appelant se rabat sur une heuristique
+        free(best);
+        free(taken);
+        return NULL;
+    }
+
+    for (int i = 0; i < n; i++)
+    {
+        int w1 = instance->weights[0][i];
+        int w2 = instance->m == 2 ? instance->weights[1][i] : 0;
+        int p = instance->profits[i];
+        if (w1 >= rows || w2 >= columns)
+        {
+            continue;
+        }
+        uint64_t *bits = &taken[(size_t)i * words];
+        for (int c1 = rows - 1; c1 >= w1; c1--)
+        {
+            int *row = &best[(size_t)c1 * columns];
+            const int *source = &best[(size_t)(c1 - w1) * columns];
+            for (int c2 = columns - 1; c2 >= w2; c2--)
+            {
+                int candidate = source[c2 - w2] + p;
+                if (candidate > row[c2])
+                {
+                    row[c2] = candidate;
+                    size_t cell = (size_t)c1 * columns + c2;
+                    bits[cell >> 6] |= 1ULL << (cell & 63);
+                }
+            }
+        }
+    }
+
+    // Remontée depuis la case des pleines capacités
+    KnapsackSolution *solution = init_solution(n);
+    solution->Z = best[cells - 1];
+    int c1 = rows - 1;
+    int c2 = columns - 1;
+    for (int i = n - 1; i >= 0; i--)
+    {
+        size_t cell = (size_t)c1 * columns + c2;
+        if (taken[(size_t)i * words + (cell >> 6)] & (1ULL << (cell & 63)))
+        {
+            solution->x[i] = 1;
+            c1 -= instance->weights[0][i];
+            c2 -= instance->m == 2 ? instance->weights[1][i] : 0;
+        }
+    }
+
+    free(best);
+    free(taken);
+    return solution;
+}
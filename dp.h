@@ -0,0 +1,40 @@
+#ifndef DP_H
+#define DP_H
+
+#include "knapsack.h"
+
+/**
+ * @brief Mémoire maximale (en octets) accordée par défaut à la programmation dynamique.
+ */
+#define DP_MEMORY_LIMIT ((size_t)256 << 20)
+
+/**
+ * @brief Mémoire nécessaire à la programmation dynamique exacte.
+ *
+ * Pour m <= 2, la table des valeurs compte (C1 + 1) × (C2 + 1) cases (C2 = 0 si m = 1),
+ * chaque capacité étant ramenée à la somme des poids de sa contrainte si elle est plus
+ * petite. S'y ajoute un bit par objet et par case pour reconstruire la solution.
+ *
+ * @param instance Instance du problème.
+ * @return Le nombre d'octets nécessaires, ou 0 si m > 2 (méthode inapplicable).
+ */
+size_t dp_memory_estimate(const KnapsackInstance *instance);
+
+/**
+ * @brief Résout exactement une instance à une ou deux contraintes par programmation dynamique.
+ *
+ * La table `best[c1][c2]` (meilleure valeur pour des charges au plus c1 et c2) est mise à
+ * jour objet par objet, en place, par charges décroissantes : chaque ligne c1 ne lit que la
+ * ligne c1 - w1, encore inchangée, et la boucle intérieure sur c2 parcourt deux lignes
+ * contiguës. Chaque amélioration est notée dans un bit, ce qui permet de remonter la
+ * solution depuis la case des pleines capacités. La valeur maximale sur toutes les charges
+ * joue le rôle de la dominance : un état n'est conservé que s'il est le meilleur de sa case.
+ *
+ * @param instance Instance du problème (m <= 2).
+ * @param memory_limit Mémoire maximale en octets (voir `dp_memory_estimate`).
+ * @return Une solution optimale (à libérer avec `free_solution`), ou `NULL` si m > 2 ou si
+ *         la table dépasse `memory_limit` : il faut alors se rabattre sur une heuristique.
+ */
+KnapsackSolution *dp_solve(const KnapsackInstance *instance, size_t memory_limit);
+
+#endif // DP_H
@@ -0,0 +1,157 @@
+#include "eda.h"
+#include <string.h>
+
+typedef struct {
+    const KnapsackInstance *instance;
+    const unsigned int *thresholds; // Seuil de chaque objet : p[i] * 2^32
+    const int *order;               // Ordre d'efficacité pour la réparation
+    KnapsackSolution **samples;
+    unsigned long long seed;
+    long long first_task;           // Rang global de la première solution du lot
+} SampleBatch;
+
+// Valeurs du lot pour qsort (propres à chaque thread)
+static _Thread_local const KnapsackSolution *const *ranking_samples = NULL;
+
+// Valeur décroissante, puis indice croissant (tri déterministe)
+static int compare_samples(const void *a, const void *b)
+{
+    int za = ranking_samples[*(const int *)a]->Z;
+    int zb = ranking_samples[*(const int *)b]->Z;
+    if (za != zb)
+    {
+        return (za < zb) - (za > zb);
+    }
+    return *(const int *)a - *(const int *)b;
+}
+
+EdaConfig default_eda_config(void)
+{
+    EdaConfig config;
+    config.variant = EDA_PBIL;
+    config.batch_size = 100;
+    config.selection_fraction = 0.2;
+    config.learning_rate = 0.1;
+    config.iterations = 100000;
+    config.seed = 1;
+    config.pool = NULL;
+    return config;
+}
+
+// Tirage de Bernoulli : le i-ème nombre est celui de splitmix64 au compteur i, calculable
+// indépendamment des autres ; la boucle, sans branchement, est vectorisable
+static void sample_bernoulli(int *x, const unsigned int *thresholds, int n, unsigned long long base)
+{
+    for (int i = 0; i < n; i++)
+    {
+        unsigned long long z = base + (unsigned long long)(i + 1) * 0x9E3779B97F4A7C15ULL;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        z ^= z >> 31;
+        x[i] = (unsigned int)(z >> 32) < thresholds[i];
+    }
+}
+
+static void sample_and_repair(void *arg, int index)
+{
+    SampleBatch *batch = (SampleBatch *)arg;
+    KnapsackSolution *sample = batch->samples[index];
+    sample_bernoulli(sample->x, batch->thresholds, batch->instance->n, rng_derive(batch->seed, batch->first_task + index));
+    repair_solution(sample, batch->instance, batch->order);
+}
+
+KnapsackSolution *eda_search(const KnapsackInstance *instance, const EdaConfig *config, double time_limit)
+{
+    TimeValue start = get_current_time();
+    int n = instance->n;
+    int size = config->batch_size;
+    int selected = (int)(config->selection_fraction * size);
+    if (selected < 1)
+    {
+        selected = 1;
+    }
+    double low = 1.0 / n;
+    double high = 1.0 - low;
+
+    double *probabilities = (double *)malloc(n * sizeof(double));
+    unsigned int *thresholds = (unsigned int *)malloc(n * sizeof(unsigned int));
+    int *counts = (int *)malloc(n * sizeof(int));
+    int *ranking = (int *)malloc(size * sizeof(int));
+    KnapsackSolution **samples = (KnapsackSolution **)calloc(size, sizeof(KnapsackSolution *));
+    int *order = efficiency_order(instance);
+    KnapsackSolution *best = NULL;
+    if (!probabilities || !thresholds || !counts || !ranking || !samples)
+    {
+        perror("Erreur d'allocation mémoire (eda_search)");
+        goto cleanup;
+    }
+    for (int s = 0; s < size; s++)
+    {
+        samples[s] = init_solution(n);
+    }
+    for (int i = 0; i < n; i++)
+    {
+        probabilities[i] = 0.5;
+    }
+    best = init_solution(n);
+
+    SampleBatch batch = {instance, thresholds, order, samples, config->seed, 0};
+    for (int it = 0; it < config->iterations && !time_exceeded(start, time_limit) && !target_reached(best->Z); it++)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            thresholds[i] = (unsigned int)(probabilities[i] * 4294967296.0);
+        }
+
+        // Tirage et réparation du lot, indépendants d'une solution à l'autre
+        batch.first_task = (long long)it * size;
+        thread_pool_parallel_for(config->pool, size, sample_and_repair, &batch);
+
+        for (int s = 0; s < size; s++)
+        {
+            ranking[s] = s;
+        }
+        ranking_samples = (const KnapsackSolution *const *)samples;
+        qsort(ranking, size, sizeof(int), compare_samples);
+        if (samples[ranking[0]]->Z > best->Z)
+        {
+            copy_solution_into(best, samples[ranking[0]], n);
+        }
+
+        // Fréquences des objets parmi les meilleures solutions du lot
+        memset(counts, 0, n * sizeof(int));
+        for (int r = 0; r < selected; r++)
+        {
+            const int *x = samples[ranking[r]]->x;
+            for (int i = 0; i < n; i++)
+            {
+                counts[i] += x[i];
+            }
+        }
+        double rate = config->variant == EDA_UMDA ? 1.0 : config->learning_rate;
+        for (int i = 0; i < n; i++)
+        {
+            double p = (1.0 - rate) * probabilities[i] + rate * counts[i] / selected;
+            probabilities[i] = p < low ? low : (p > high ? high : p);
+        }
+    }
+
+cleanup:
+    if (samples)
+    {
+        for (int s = 0; s < size; s++)
+        {
+            if (samples[s])
+            {
+                free_solution(samples[s]);
+            }
+        }
+    }
+    free(samples);
+    free(probabilities);
+    free(thresholds);
+    free(counts);
+    free(ranking);
+    free(order);
+    return best;
+}
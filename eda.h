@@ -0,0 +1,56 @@
+#ifndef EDA_H
+#define EDA_H
+
+#include "heuristique.h"
+#include "thread_pool.h"
+
+/**
+ * @brief Variante de la mise à jour du modèle probabiliste.
+ */
+typedef enum {
+    EDA_PBIL, ///< Les probabilités se rapprochent des fréquences sélectionnées (taux `learning_rate`).
+    EDA_UMDA  ///< Les probabilités sont remplacées par les fréquences sélectionnées.
+} EdaVariant;
+
+/**
+ * @brief Paramètres de l'algorithme à estimation de distribution (PBIL / UMDA).
+ *
+ * Le modèle est un vecteur de probabilités p[i] de sélectionner l'objet i. À chaque
+ * itération, un lot de solutions est tiré (un Bernoulli par objet), réparé par l'opérateur
+ * de Chu et Beasley, puis les meilleures solutions du lot mettent le modèle à jour.
+ * Les probabilités restent dans [1/n, 1 - 1/n] pour ne jamais figer un objet.
+ */
+typedef struct {
+    EdaVariant variant;        ///< Règle de mise à jour du modèle.
+    int batch_size;            ///< Nombre de solutions tirées par itération.
+    double selection_fraction; ///< Part des meilleures solutions du lot qui mettent le modèle à jour.
+    double learning_rate;      ///< Taux d'apprentissage de PBIL (ignoré par UMDA).
+    int iterations;            ///< Nombre maximal d'itérations.
+    unsigned long long seed;   ///< Graine de l'échantillonnage.
+    ThreadPool *pool;          ///< Pool pour tirer et réparer le lot en parallèle (`NULL` : séquentiel).
+} EdaConfig;
+
+/**
+ * @brief Retourne la configuration par défaut (PBIL, lots de 100, 20 % sélectionnés, taux 0.1).
+ *
+ * @return La configuration par défaut.
+ */
+EdaConfig default_eda_config(void);
+
+/**
+ * @brief Exécute PBIL ou UMDA jusqu'au nombre d'itérations ou à l'échéance.
+ *
+ * Chaque solution du lot est tirée avec sa propre graine, dérivée de la graine de la
+ * recherche et de son rang : le résultat ne dépend pas du nombre de threads (sauf arrêt
+ * sur échéance). Le tirage compare une suite de nombres pseudo-aléatoires indexée par
+ * objet à des seuils entiers, sans branchement ni dépendance entre objets, ce qui laisse
+ * le compilateur le vectoriser.
+ *
+ * @param instance Instance du problème.
+ * @param config Paramètres de l'algorithme.
+ * @param time_limit Durée maximale en secondes (0 pour illimité), vérifiée entre deux itérations.
+ * @return La meilleure solution trouvée (à libérer avec `free_solution`), ou `NULL` en cas d'erreur.
+ */
+KnapsackSolution *eda_search(const KnapsackInstance *instance, const EdaConfig *config, double time_limit);
+
+#endif // EDA_H
@@ -1,4 +1,6 @@
 #include "genetic.h"
+#include <string.h>
+#include <math.h>
 
 Individual *init_individual(int n)
 {
@@ -17,6 +19,10 @@ Individual *init_individual(int n)
     }
 
     individual->fitness = 0;
+    individual->bits = NULL;
+    individual->load = NULL;
+    individual->hash = 0;
+    individual->improved = 0;
     return individual;
 }
 
@@ -26,6 +32,8 @@ void free_individual(Individual *individual) {
         if (individual->solution != NULL) {
             free_solution(individual->solution); // Libère la mémoire de KnapsackSolution
         }
+        free(individual->bits);
+        free(individual->load);
         // Pas besoin de libérer individual lui-même car il est généralement alloué dans un tableau
     }
 }
@@ -42,14 +50,14 @@ void free_population(Individual *population, int population_size) {
 
 // Fonction de sélection par tournoi
 Individual* tournament_selection(Individual *population, int population_size) {
-    int i1 = rand() % population_size;
-    int i2 = rand() % population_size;
+    int i1 = rng_rand() % population_size;
+    int i2 = rng_rand() % population_size;
     return (population[i1].fitness > population[i2].fitness) ? &population[i1] : &population[i2];
 }
 
 // Fonction de croisement en un point
 void crossover(KnapsackSolution *parent1, KnapsackSolution *parent2, KnapsackSolution *child, const KnapsackInstance *instance) {
-    int point = rand() % instance->n;
+    int point = rng_rand() % instance->n;
     for (int i = 0; i < point; i++) {
         child->x[i] = parent1->x[i];
     }
@@ -58,177 +66,642 @@ void crossover(KnapsackSolution *parent1, KnapsackSolution *parent2, KnapsackSol
     }
     evaluate_solution(child, instance);
     if (!is_feasible(child, instance)) {
-        copy_knapsack_solution(child, parent1, instance->n);
+        copy_solution_into(child, parent1, instance->n);
     }
 }
 
 // Fonction de mutation
 void mutate(KnapsackSolution *solution, const KnapsackInstance *instance, double mutation_rate) {
-    if ((double)rand() / RAND_MAX < mutation_rate) {
-        KnapsackSolution *temp = init_solution(instance->n);
-        copy_knapsack_solution(temp, solution, instance->n);
-        random_flip(temp, instance, 1);
-        if (is_feasible(temp, instance)) {
-            copy_knapsack_solution(solution, temp, instance->n);
+    if ((double)rng_rand() / RAND_MAX < mutation_rate) {
+        // random_flip annule lui-même un flip infaisable : aucune copie temporaire n'est nécessaire
+        random_flip(solution, instance, 1);
+    }
+}
+
+// Table de Zobrist de l'exécution en cours (NULL sans déduplication)
+static _Thread_local const ZobristTable *ga_zobrist = NULL;
+
+// Archive d'élites de l'exécution en cours (NULL sans path relinking)
+static _Thread_local EliteArchive *ga_archive = NULL;
+
+// Nombre de mots de 64 bits pour n objets
+static int word_count(int n) {
+    return (n + 63) / 64;
+}
+
+void sync_individual(Individual *individual, const KnapsackInstance *instance) {
+    for (int w = 0; w < word_count(instance->n); w++) {
+        individual->bits[w] = 0;
+    }
+    for (int k = 0; k < instance->m; k++) {
+        individual->load[k] = 0;
+    }
+    int Z = 0;
+    for (int i = 0; i < instance->n; i++) {
+        if (individual->solution->x[i]) {
+            individual->bits[i >> 6] |= 1ULL << (i & 63);
+            Z += instance->profits[i];
+            for (int k = 0; k < instance->m; k++) {
+                individual->load[k] += instance->weights[k][i];
+            }
         }
-        free_solution(temp);
     }
+    individual->solution->Z = Z;
+    individual->fitness = Z;
+    individual->hash = ga_zobrist ? zobrist_hash(ga_zobrist, individual->solution->x) : 0;
 }
 
-KnapsackSolution* genetic_algorithm(const KnapsackInstance *instance, int population_size, int generations, double mutation_rate, int time_limit) {
-    // LARGE_INTEGER start_time;
+static void copy_individual(Individual *dest, const Individual *src, const KnapsackInstance *instance) {
+    copy_solution_into(dest->solution, src->solution, instance->n);
+    memcpy(dest->bits, src->bits, word_count(instance->n) * sizeof(unsigned long long));
+    memcpy(dest->load, src->load, instance->m * sizeof(int));
+    dest->fitness = src->fitness;
+    dest->hash = src->hash;
+    dest->improved = src->improved;
+}
 
-    if (time_limit > 0) {
-        timeout_flag = 0;
-        start_time = get_current_time();
-        if (setjmp(env) != 0) {
-            printf("Temps écoulé ! Arrêt de l'algorithme (genetic_algorithm).\n");
-            goto cleanup;
+// Inverse l'objet i en mettant à jour Z et les charges en O(m)
+static void flip_item(Individual *individual, const KnapsackInstance *instance, int i) {
+    int sign = individual->solution->x[i] ? -1 : 1;
+    individual->solution->x[i] = 1 - individual->solution->x[i];
+    individual->bits[i >> 6] ^= 1ULL << (i & 63);
+    individual->improved = 0;
+    if (ga_zobrist) {
+        individual->hash = zobrist_flip(ga_zobrist, individual->hash, i);
+    }
+    individual->solution->Z += sign * instance->profits[i];
+    for (int k = 0; k < instance->m; k++) {
+        individual->load[k] += sign * instance->weights[k][i];
+    }
+}
+
+static int load_feasible(const int *load, const KnapsackInstance *instance) {
+    for (int k = 0; k < instance->m; k++) {
+        if (load[k] > instance->capacities[k]) {
+            return 0;
         }
     }
+    return 1;
+}
 
-    static Individual *population = NULL;
-    population = malloc(population_size * sizeof(Individual));
-    if (!population) {
-        perror("Erreur d'allocation mémoire pour population (genetic_algorithm)");
-        return NULL;
+// Masque des objets [first, last[ dans le mot w
+static unsigned long long range_mask(int w, int first, int last) {
+    int lo = w * 64;
+    int s = first > lo ? first - lo : 0;
+    int e = last - lo < 64 ? last - lo : 64;
+    if (s >= e) {
+        return 0;
+    }
+    unsigned long long upper = (e == 64) ? ~0ULL : (1ULL << e) - 1;
+    return upper & ~((1ULL << s) - 1);
+}
+
+void crossover_bits(const Individual *parent1, const Individual *parent2, Individual *child, const KnapsackInstance *instance, CrossoverType type) {
+    const Individual *base = parent1;
+    const Individual *other = parent2;
+    int first = 0;
+    int last = instance->n;
+    double take_probability = 0.5;
+
+    switch (type) {
+    case CROSSOVER_ONE_POINT:
+        // Même tirage que `crossover` : [point, n[ vient du second parent
+        first = rng_rand() % instance->n;
+        break;
+    case CROSSOVER_TWO_POINT: {
+        int a = rng_rand() % instance->n;
+        int b = rng_rand() % instance->n;
+        first = a < b ? a : b;
+        last = a < b ? b : a;
+        break;
+    }
+    case CROSSOVER_UNIFORM:
+        break;
+    case CROSSOVER_FITNESS_UNIFORM: {
+        if (parent2->fitness > parent1->fitness) {
+            base = parent2;
+            other = parent1;
+        }
+        double total = parent1->fitness + parent2->fitness;
+        take_probability = total > 0 ? other->fitness / total : 0.5;
+        break;
     }
-    
-    // Initialisation de la population
-    for (int i = 0; i < population_size; i++) {
-        population[i].solution = random_initial_solution(instance);
-        evaluate_solution(population[i].solution, instance);
-        population[i].fitness = population[i].solution->Z;
     }
 
-    for (int gen = 0; gen < generations; gen++) {
-        Individual *new_population = malloc(population_size * sizeof(Individual));
-        if (!new_population) {
-            free_population(population, population_size);
-            return NULL;
+    copy_individual(child, base, instance);
+    for (int w = 0; w < word_count(instance->n); w++) {
+        // Seuls les objets où les parents diffèrent peuvent changer l'enfant
+        unsigned long long diff = base->bits[w] ^ other->bits[w];
+        if (diff == 0) {
+            continue;
         }
-        
-        for (int i = 0; i < population_size; i++) {
-            Individual *parent1 = tournament_selection(population, population_size);
-            Individual *parent2 = tournament_selection(population, population_size);
-            
-            new_population[i].solution = init_solution(instance->n);
-            crossover(parent1->solution, parent2->solution, new_population[i].solution, instance);
-            mutate(new_population[i].solution, instance, mutation_rate);
-            evaluate_solution(new_population[i].solution, instance);
-            new_population[i].fitness = new_population[i].solution->Z;
-            
-            if (time_limit > 0) check_timeout(start_time, time_limit);
+        if (type == CROSSOVER_UNIFORM) {
+            diff &= rng_rand64();
+        } else if (type != CROSSOVER_FITNESS_UNIFORM) {
+            diff &= range_mask(w, first, last);
         }
-        
-        for (int i = 0; i < population_size; i++) {
-            free_individual(&population[i]);
-            population[i] = new_population[i];
+        while (diff) {
+            int i = w * 64 + __builtin_ctzll(diff);
+            diff &= diff - 1;
+            if (type == CROSSOVER_FITNESS_UNIFORM && (double)rng_rand() / RAND_MAX >= take_probability) {
+                continue;
+            }
+            flip_item(child, instance, i);
         }
-        free(new_population);
     }
 
-cleanup:
-    if (population) {
-        Individual *best = &population[0];
-        for (int i = 1; i < population_size; i++) {
-            if (population[i].fitness > best->fitness) {
-                best = &population[i];
-            }
+    if (!load_feasible(child->load, instance)) {
+        copy_individual(child, base, instance);
+    }
+    child->fitness = child->solution->Z;
+}
+
+// Même mutation que `mutate`, appliquée sur le cache de l'individu
+static void mutate_individual(Individual *individual, const KnapsackInstance *instance, double mutation_rate) {
+    if ((double)rng_rand() / RAND_MAX < mutation_rate) {
+        int i = rng_rand() % instance->n;
+        flip_item(individual, instance, i);
+        if (!load_feasible(individual->load, instance)) {
+            flip_item(individual, instance, i);
         }
-        if (best == NULL || best->solution == NULL) {
-            free_population(population, population_size);
-            return NULL;
+        individual->fitness = individual->solution->Z;
+    }
+}
+
+// État de la mutation au cours d'une exécution
+typedef struct {
+    double rate;     // Taux courant (par individu ou par objet selon le mode)
+    double max_rate; // Borne supérieure du taux adapté
+    long successes;  // Enfants meilleurs que leurs deux parents depuis la dernière adaptation
+    long trials;     // Enfants produits depuis la dernière adaptation
+    int *order;      // Ordre d'efficacité pour la réparation (mode par objet)
+} MutationState;
+
+// Réparation de Chu et Beasley appliquée sur le cache de l'individu (voir `repair_solution`)
+static void repair_individual(Individual *individual, const KnapsackInstance *instance, const int *order) {
+    for (int r = instance->n - 1; r >= 0 && !load_feasible(individual->load, instance); r--) {
+        if (individual->solution->x[order[r]]) {
+            flip_item(individual, instance, order[r]);
         }
-        
-        KnapsackSolution *best_solution = init_solution(instance->n);
-        copy_knapsack_solution(best_solution, best->solution, instance->n);
-        
-        free_population(population, population_size);
-        return best_solution;
     }
-    
-    return NULL;
+    for (int r = 0; r < instance->n; r++) {
+        int i = order[r];
+        if (individual->solution->x[i]) {
+            continue;
+        }
+        int fits = 1;
+        for (int k = 0; k < instance->m && fits; k++) {
+            fits = individual->load[k] + instance->weights[k][i] <= instance->capacities[k];
+        }
+        if (fits) {
+            flip_item(individual, instance, i);
+        }
+    }
+    individual->fitness = individual->solution->Z;
+}
+
+// Mutation par objet : les positions inversées sont tirées par sauts géométriques, en O(nombre de flips)
+static void mutate_bits(Individual *individual, const KnapsackInstance *instance, double bit_rate, const int *order) {
+    double log_keep = log(1.0 - bit_rate);
+    int i = -1;
+    for (;;) {
+        // Nombre d'objets épargnés avant le prochain flip ~ loi géométrique de paramètre bit_rate
+        double u = (rng_rand() + 1.0) / ((double)RAND_MAX + 1.0);
+        double skip = floor(log(u) / log_keep);
+        if (i + 1 + skip >= instance->n) {
+            break;
+        }
+        i += 1 + (int)skip;
+        flip_item(individual, instance, i);
+    }
+    repair_individual(individual, instance, order);
 }
 
+// Adapte le taux de mutation selon la règle du 1/5 de Rechenberg
+static void adapt_mutation(MutationState *state, const KnapsackInstance *instance) {
+    if (state->trials == 0) {
+        return;
+    }
+    double success = (double)state->successes / state->trials;
+    if (success > 0.2) {
+        state->rate /= GA_ADAPT_FACTOR;
+    } else if (success < 0.2) {
+        state->rate *= GA_ADAPT_FACTOR;
+    }
+    double lower = 1.0 / instance->n;
+    if (state->rate < lower) state->rate = lower;
+    if (state->rate > state->max_rate) state->rate = state->max_rate;
+    state->successes = 0;
+    state->trials = 0;
+}
 
+// Options de départ de genetic_algorithm et hybrid_GA_VNS (réglées avant le lancement des threads)
+static GeneticConfig genetic_options;
+static int genetic_options_set = 0;
+
+GeneticConfig default_genetic_config(void) {
+    GeneticConfig config;
+    config.population_size = 600;
+    config.generations = 1000;
+    config.mutation_rate = 0.05;
+    config.mode = GA_GENERATIONAL;
+    config.elitism = 0;
+    config.vns_iterations = 0;
+    config.k_perturbation = 2;
+    config.crossover = CROSSOVER_ONE_POINT;
+    config.deduplicate = 0;
+    config.mutation_mode = MUTATION_SINGLE_FLIP;
+    config.bit_mutation_rate = 0.0;
+    config.adaptive_mutation = 0;
+    config.dual_repair = 0;
+    config.memetic_budget = 0.0;
+    config.elite_fraction = 0.1;
+    config.archive_size = 0;
+    config.relinking_time = 0.0;
+    return config;
+}
 
-KnapsackSolution* hybrid_GA_VNS(const KnapsackInstance *instance, int population_size, int generations, double mutation_rate, int vns_iterations, int k, int time_limit) {
-    // LARGE_INTEGER start_time;
+void configure_genetic_options(const GeneticConfig *options) {
+    genetic_options_set = options != NULL;
+    if (options) {
+        genetic_options = *options;
+    }
+}
 
-    if (time_limit > 0) {
-        timeout_flag = 0;
-        start_time = get_current_time();
-        if (setjmp(env) != 0) {
-            printf("Temps écoulé ! Arrêt de l'algorithme (hybrid_GA_VNS).\n");
-            goto cleanup;
+int parse_genetic_option(int argc, char *argv[], int *i, GeneticConfig *options) {
+    const char *option = argv[*i];
+    int has_value = *i + 1 < argc;
+    if (strcmp(option, "--ga-steady") == 0) {
+        options->mode = GA_STEADY_STATE;
+    } else if (strcmp(option, "--ga-elitism") == 0 && has_value) {
+        options->elitism = atoi(argv[++*i]);
+    } else if (strcmp(option, "--ga-crossover") == 0 && has_value) {
+        const char *type = argv[++*i];
+        if (strcmp(type, "2p") == 0) {
+            options->crossover = CROSSOVER_TWO_POINT;
+        } else if (strcmp(type, "uniform") == 0) {
+            options->crossover = CROSSOVER_UNIFORM;
+        } else if (strcmp(type, "fitness") == 0) {
+            options->crossover = CROSSOVER_FITNESS_UNIFORM;
+        } else {
+            options->crossover = CROSSOVER_ONE_POINT;
         }
+    } else if (strcmp(option, "--ga-dedup") == 0) {
+        options->deduplicate = 1;
+    } else if (strcmp(option, "--ga-bit-mutation") == 0) {
+        options->mutation_mode = MUTATION_PER_BIT;
+    } else if (strcmp(option, "--ga-adaptive") == 0) {
+        options->mutation_mode = MUTATION_PER_BIT;
+        options->adaptive_mutation = 1;
+    } else if (strcmp(option, "--memetic") == 0 && has_value) {
+        options->memetic_budget = atof(argv[++*i]);
+    } else if (strcmp(option, "--elite-fraction") == 0 && has_value) {
+        options->elite_fraction = atof(argv[++*i]);
+    } else if (strcmp(option, "--ga-archive") == 0 && has_value) {
+        options->archive_size = atoi(argv[++*i]);
+    } else if (strcmp(option, "--relinking-time") == 0 && has_value) {
+        options->relinking_time = atof(argv[++*i]);
+    } else {
+        return 0;
     }
+    return 1;
+}
 
-    static Individual *population = NULL; 
-    population = malloc(population_size * sizeof(Individual));
+void print_genetic_options_usage(void) {
+    printf("--ga-steady : génétique stationnaire, --ga-elitism k : k élites conservées par génération\n");
+    printf("--ga-crossover 1p|2p|uniform|fitness : croisement sur mots de 64 bits, --ga-dedup : rejet des enfants en double (Zobrist)\n");
+    printf("--ga-bit-mutation : mutation par objet puis réparation, --ga-adaptive : idem avec taux adapté (règle du 1/5)\n");
+    printf("--memetic secondes : budget de VNS par génération de l'hybride, réparti selon le rang ; --elite-fraction f : fraction éligible\n");
+    printf("--ga-archive taille : archive d'élites reliées par path relinking en fin d'exécution, --relinking-time secondes : durée de cette phase\n");
+}
+
+Individual *alloc_population(int population_size, const KnapsackInstance *instance, int random_init) {
+    Individual *population = (Individual *)calloc(population_size, sizeof(Individual));
     if (!population) {
-        perror("Erreur d'allocation mémoire pour population (hybrid_GA_VNS)");
+        perror("Erreur d'allocation mémoire pour population (alloc_population)");
         return NULL;
     }
-
     for (int i = 0; i < population_size; i++) {
-        population[i].solution = random_initial_solution(instance);
-        population[i].fitness = population[i].solution->Z;
+        population[i].solution = random_init ? random_initial_solution(instance) : init_solution(instance->n);
+        population[i].bits = (unsigned long long *)calloc(word_count(instance->n), sizeof(unsigned long long));
+        population[i].load = (int *)calloc(instance->m, sizeof(int));
+        if (!population[i].solution || !population[i].bits || !population[i].load) {
+            free_population(population, i + 1);
+            return NULL;
+        }
+        if (random_init) {
+            sync_individual(&population[i], instance);
+        }
     }
+    return population;
+}
 
-    for (int gen = 0; gen < generations; gen++) {
+static int best_index(const Individual *population, int population_size) {
+    int best = 0;
+    for (int i = 1; i < population_size; i++) {
+        if (population[i].fitness > population[best].fitness) {
+            best = i;
+        }
+    }
+    return best;
+}
 
-        Individual *new_population = malloc(population_size * sizeof(Individual));
-        if (!new_population) {
-            perror("Erreur d'allocation mémoire pour new_population");
-            break;
+static int worst_index(const Individual *population, int population_size) {
+    int worst = 0;
+    for (int i = 1; i < population_size; i++) {
+        if (population[i].fitness < population[worst].fitness) {
+            worst = i;
         }
+    }
+    return worst;
+}
 
-        for (int i = 0; i < population_size; i++) {
-            Individual *parent1 = tournament_selection(population, population_size);
-            Individual *parent2 = tournament_selection(population, population_size);
+// Population de référence pour le tri des élites (qsort n'a pas de paramètre utilisateur)
+static _Thread_local const Individual *elite_sort_population = NULL;
+
+static int compare_elite(const void *a, const void *b) {
+    double fa = elite_sort_population[*(const int *)a].fitness;
+    double fb = elite_sort_population[*(const int *)b].fitness;
+    return (fa < fb) - (fa > fb);
+}
 
-            KnapsackSolution *child = init_solution(instance->n);
-            crossover(parent1->solution, parent2->solution, child, instance);
-            mutate(child, instance, mutation_rate);
-            evaluate_solution(child, instance);
+// Produit un enfant en place dans `child` à partir de deux parents tirés dans `population`.
+// Avec `seen`, les doublons sont reproduits avant le VNS ; retourne 0 si l'enfant reste un doublon.
+// `promising` reçoit 1 si l'enfant dépasse ses deux parents.
+static int breed_child(Individual *population, int population_size, Individual *child, const KnapsackInstance *instance, const GeneticConfig *config, const SolutionHashSet *seen, MutationState *mutation, int *promising) {
+    int attempts = 0;
+    do {
+        Individual *parent1 = tournament_selection(population, population_size);
+        Individual *parent2 = tournament_selection(population, population_size);
+        crossover_bits(parent1, parent2, child, instance, config->crossover);
+        if (config->mutation_mode == MUTATION_PER_BIT) {
+            mutate_bits(child, instance, mutation->rate, mutation->order);
+        } else {
+            mutate_individual(child, instance, mutation->rate);
+        }
+        // Succès : l'enfant dépasse ses deux parents
+        double parents_best = parent1->fitness > parent2->fitness ? parent1->fitness : parent2->fitness;
+        *promising = child->fitness > parents_best;
+        mutation->successes += *promising;
+        mutation->trials++;
+    } while (seen && hash_set_contains(seen, child->hash) && ++attempts < GA_DEDUP_ATTEMPTS);
+
+    if (seen && attempts == GA_DEDUP_ATTEMPTS) {
+        return 0;
+    }
+    if (config->vns_iterations > 0 && config->memetic_budget <= 0) {
+        variable_neighborhood_search(child->solution, instance, config->vns_iterations, config->k_perturbation, 0);
+        sync_individual(child, instance);
+        child->improved = 1;
+        if (ga_archive) elite_archive_insert(ga_archive, child->solution);
+    }
+    return 1;
+}
 
-            new_population[i].solution = child;
-            new_population[i].fitness = child->Z;
+// VNS borné en temps sur un individu, qui devient un optimum de recherche locale
+static void improve_individual(Individual *individual, const KnapsackInstance *instance, const GeneticConfig *config, double seconds) {
+    variable_neighborhood_search_budget(individual->solution, instance, config->vns_iterations, config->k_perturbation, get_current_time(), seconds);
+    sync_individual(individual, instance);
+    individual->improved = 1;
+    if (ga_archive) elite_archive_insert(ga_archive, individual->solution);
+}
 
-            // Vérification du timeout à chaque itération
-            if (time_limit > 0) check_timeout(start_time, time_limit);
+// Planification mémétique d'une génération : budget réparti par rang entre l'élite et les enfants prometteurs
+static void schedule_local_search(Individual *offspring, int count, const int *promising, int *ranking, const KnapsackInstance *instance, const GeneticConfig *config, int time_limit) {
+    for (int i = 0; i < count; i++) {
+        ranking[i] = i;
+    }
+    elite_sort_population = offspring;
+    qsort(ranking, count, sizeof(int), compare_elite);
+
+    // Candidats compactés en tête de `ranking`, dans l'ordre des rangs
+    int elite_count = (int)ceil(config->elite_fraction * count);
+    int selected = 0;
+    for (int r = 0; r < count; r++) {
+        int i = ranking[r];
+        if (!offspring[i].improved && (r < elite_count || promising[i])) {
+            ranking[selected++] = i;
         }
+    }
+
+    // Part du j-ième candidat proportionnelle à (selected - j)
+    double total_weight = selected * (selected + 1) / 2.0;
+    for (int j = 0; j < selected; j++) {
+        improve_individual(&offspring[ranking[j]], instance, config, config->memetic_budget * (selected - j) / total_weight);
+        if (time_limit > 0) check_timeout(start_time, time_limit);
+    }
+}
+
+KnapsackSolution* genetic_algorithm_config(const KnapsackInstance *instance, const GeneticConfig *config, int time_limit) {
+    int population_size = config->population_size;
+    int elitism = config->elitism < population_size ? config->elitism : population_size;
+
+    // Statiques pour rester valides après un longjmp
+    static _Thread_local Individual *population = NULL;
+    static _Thread_local Individual *offspring = NULL;
+    static _Thread_local int *ranking = NULL;
+    static _Thread_local ZobristTable *zobrist = NULL;
+    static _Thread_local SolutionHashSet seen_set;
+    static _Thread_local SolutionHashSet *seen = NULL;
+    static _Thread_local MutationState mutation;
+    static _Thread_local int *promising = NULL;
+
+    // Archive alimentée pendant l'exécution, reliée en fin d'exécution
+    ga_archive = config->archive_size > 0 ? elite_archive_create(config->archive_size, instance->n, instance->n / 50 > 2 ? instance->n / 50 : 2) : NULL;
+
+    // Taux initial : par individu (un flip), ou par objet (1/n par défaut)
+    mutation.successes = 0;
+    mutation.trials = 0;
+    mutation.order = NULL;
+    if (config->mutation_mode == MUTATION_PER_BIT) {
+        mutation.rate = config->bit_mutation_rate > 0 ? config->bit_mutation_rate : 1.0 / instance->n;
+        mutation.max_rate = 0.5;
+        mutation.order = config->dual_repair ? lp_utility_order(instance) : efficiency_order(instance);
+    } else {
+        mutation.rate = config->mutation_rate;
+        mutation.max_rate = 1.0;
+    }
+    // La règle du 1/5 et ses bornes par objet ne s'appliquent qu'au taux par objet
+    int adaptive = config->adaptive_mutation && config->mutation_mode == MUTATION_PER_BIT;
+
+    // Empreintes calculées dès l'initialisation de la population
+    zobrist = config->deduplicate ? zobrist_create(instance->n, 0x5EEDC0DEULL) : NULL;
+    ga_zobrist = zobrist;
+    seen = NULL;
+    if (zobrist && hash_set_init(&seen_set, population_size) == 0) {
+        seen = &seen_set;
+    }
+
+    // Population initiale aléatoire et tampon des enfants, alloués une fois pour toute l'exécution
+    population = alloc_population(population_size, instance, 1);
+    offspring = alloc_population(config->mode == GA_STEADY_STATE ? 1 : population_size, instance, 0);
+    ranking = (int *)malloc(population_size * sizeof(int));
+    promising = (int *)calloc(population_size, sizeof(int));
+    if (!population || !offspring || !ranking || !promising) {
+        perror("Erreur d'allocation mémoire pour population (genetic_algorithm_config)");
+        free_population(population, population_size);
+        free_population(offspring, config->mode == GA_STEADY_STATE ? 1 : population_size);
+        free(ranking);
+        free(promising);
+        free(mutation.order);
+        if (seen) hash_set_free(seen);
+        zobrist_free(zobrist);
+        ga_zobrist = NULL;
+        elite_archive_free(ga_archive);
+        ga_archive = NULL;
+        return NULL;
+    }
 
+    if (seen && config->mode == GA_STEADY_STATE) {
         for (int i = 0; i < population_size; i++) {
-            variable_neighborhood_search(new_population[i].solution, instance, vns_iterations, k, 0);
-            evaluate_solution(new_population[i].solution, instance);
+            hash_set_insert(seen, population[i].hash);
+        }
+    }
+
+    if (time_limit > 0) {
+        timeout_flag = 0;
+        start_time = get_current_time();
+        if (setjmp(env) != 0) {
+            printf("Temps écoulé ! Arrêt de l'algorithme (%s).\n", config->vns_iterations > 0 ? "hybrid_GA_VNS" : "genetic_algorithm");
+            goto cleanup;
+        }
+    }
+
+    for (int gen = 0; gen < config->generations; gen++) {
+        // Arrêt anticipé dès que la meilleure solution atteint la cible
+        if (target_reached(population[best_index(population, population_size)].solution->Z)) {
+            break;
+        }
+        if (config->mode == GA_STEADY_STATE) {
+            // Chaque enfant remplace le pire individu s'il le dépasse (le meilleur n'est jamais perdu)
+            for (int i = 0; i < population_size; i++) {
+                // Un doublon persistant, ou un optimum du VNS déjà présent, est écarté
+                int unique = breed_child(population, population_size, &offspring[0], instance, config, seen, &mutation, &promising[0]);
+                if (unique && promising[0] && config->vns_iterations > 0 && config->memetic_budget > 0) {
+                    improve_individual(&offspring[0], instance, config, config->memetic_budget / population_size);
+                }
+                unique = unique && !(seen && hash_set_contains(seen, offspring[0].hash));
+                int worst = worst_index(population, population_size);
+                if (unique && offspring[0].fitness > population[worst].fitness) {
+                    if (seen) {
+                        hash_set_remove(seen, population[worst].hash);
+                        hash_set_insert(seen, offspring[0].hash);
+                    }
+                    Individual tmp = population[worst];
+                    population[worst] = offspring[0];
+                    offspring[0] = tmp;
+                    if (target_reached(population[worst].solution->Z)) {
+                        goto cleanup;
+                    }
+                }
+                if (time_limit > 0) check_timeout(start_time, time_limit);
+            }
+            if (adaptive) adapt_mutation(&mutation, instance);
+            if (ga_archive) elite_archive_insert(ga_archive, population[best_index(population, population_size)].solution);
+            continue;
+        }
+
+        if (seen) {
+            hash_set_clear(seen);
+        }
 
-            // Vérification du timeout à chaque itération
+        // Les `elitism` meilleurs individus sont recopiés tels quels en tête de la génération suivante
+        if (elitism > 0) {
+            for (int i = 0; i < population_size; i++) {
+                ranking[i] = i;
+            }
+            elite_sort_population = population;
+            qsort(ranking, population_size, sizeof(int), compare_elite);
+            for (int e = 0; e < elitism; e++) {
+                copy_individual(&offspring[e], &population[ranking[e]], instance);
+                if (seen) hash_set_insert(seen, offspring[e].hash);
+            }
+        }
+
+        // Enfants écrits en place ; un timeout laisse `population` intacte
+        for (int i = elitism; i < population_size; i++) {
+            breed_child(population, population_size, &offspring[i], instance, config, seen, &mutation, &promising[i]);
+            if (seen) hash_set_insert(seen, offspring[i].hash);
             if (time_limit > 0) check_timeout(start_time, time_limit);
         }
 
-        free_population(population, population_size);
-        population = new_population;
+        // Recherche locale concentrée sur les enfants qui peuvent faire progresser la population
+        if (config->vns_iterations > 0 && config->memetic_budget > 0) {
+            for (int e = 0; e < elitism; e++) {
+                promising[e] = 0;
+            }
+            schedule_local_search(offspring, population_size, promising, ranking, instance, config, time_limit);
+            if (seen) {
+                // Les optima locaux changent les empreintes de la génération
+                hash_set_clear(seen);
+                for (int i = 0; i < population_size; i++) {
+                    hash_set_insert(seen, offspring[i].hash);
+                }
+            }
+        }
+
+        // Les deux tampons échangent leurs rôles
+        Individual *tmp = population;
+        population = offspring;
+        offspring = tmp;
+        if (adaptive) adapt_mutation(&mutation, instance);
+        if (ga_archive) elite_archive_insert(ga_archive, population[best_index(population, population_size)].solution);
     }
 
 cleanup:
-    // Vérifie si `population` est encore valide
-    if (population) {  
-        Individual *best_individual = &population[0];
-        for (int i = 1; i < population_size; i++) {
-            if (population[i].fitness > best_individual->fitness) {
-                best_individual = &population[i];
+    {
+        KnapsackSolution *best_solution = init_solution(instance->n);
+        copy_solution_into(best_solution, population[best_index(population, population_size)].solution, instance->n);
+
+        // Post-optimisation : path relinking entre les élites de l'archive
+        if (ga_archive) {
+            if (!target_reached(best_solution->Z)) {
+                elite_archive_insert(ga_archive, best_solution);
+                relink_archive(instance, ga_archive, 3, get_current_time(), config->relinking_time);
+                KnapsackSolution *relinked = elite_archive_best(ga_archive);
+                if (relinked && relinked->Z > best_solution->Z) {
+                    copy_solution_into(best_solution, relinked, instance->n);
+                }
+                if (relinked) free_solution(relinked);
             }
+            elite_archive_free(ga_archive);
+            ga_archive = NULL;
         }
 
-        KnapsackSolution *best_solution = init_solution(instance->n);
-        copy_knapsack_solution(best_solution, best_individual->solution, instance->n);
-
         free_population(population, population_size);
+        free_population(offspring, config->mode == GA_STEADY_STATE ? 1 : population_size);
+        free(ranking);
+        free(promising);
+        promising = NULL;
+        free(mutation.order);
+        mutation.order = NULL;
+        if (seen) hash_set_free(seen);
+        zobrist_free(zobrist);
+        population = NULL;
+        offspring = NULL;
+        ranking = NULL;
+        seen = NULL;
+        zobrist = NULL;
+        ga_zobrist = NULL;
         return best_solution;
     }
+}
 
-    return NULL;  // Si `longjmp` a provoqué une erreur avant l'initiation de population
+KnapsackSolution* genetic_algorithm(const KnapsackInstance *instance, int population_size, int generations, double mutation_rate, int time_limit) {
+    GeneticConfig config = genetic_options_set ? genetic_options : default_genetic_config();
+    config.vns_iterations = 0;
+    config.population_size = population_size;
+    config.generations = generations;
+    config.mutation_rate = mutation_rate;
+    return genetic_algorithm_config(instance, &config, time_limit);
+}
+
+KnapsackSolution* hybrid_GA_VNS(const KnapsackInstance *instance, int population_size, int generations, double mutation_rate, int vns_iterations, int k, int time_limit) {
+    GeneticConfig config = genetic_options_set ? genetic_options : default_genetic_config();
+    config.population_size = population_size;
+    config.generations = generations;
+    config.mutation_rate = mutation_rate;
+    config.vns_iterations = vns_iterations;
+    config.k_perturbation = k;
+    return genetic_algorithm_config(instance, &config, time_limit);
 }
@@ -3,6 +3,9 @@
 
 #include "heuristique.h"
 #include "chrono.h"
+#include "solution_hash.h"
+#include "path_relinking.h"
+#include "lp.h"
 
 
 /**
@@ -15,8 +18,74 @@
  typedef struct {
     KnapsackSolution *solution; ///< Solution de l'individu (KnapsackSolution).
     double fitness;             ///< Fitness de la solution (évaluation de la qualité de la solution).
+    unsigned long long *bits;   ///< Copie de `solution->x` en mots de 64 bits (`NULL` hors de `genetic_algorithm_config`).
+    int *load;                  ///< Charge de chaque contrainte (`NULL` hors de `genetic_algorithm_config`).
+    unsigned long long hash;    ///< Empreinte de Zobrist de la solution (0 si la déduplication est désactivée).
+    int improved;               ///< 1 si la solution est déjà le résultat d'une recherche locale (remis à 0 au premier flip).
 } Individual;
 
+/**
+ * @brief Nombre maximal de tentatives pour produire un enfant absent de la population.
+ */
+#define GA_DEDUP_ATTEMPTS 8
+
+/**
+ * @brief Schéma de remplacement de l'algorithme génétique.
+ */
+typedef enum {
+    GA_GENERATIONAL, ///< Chaque génération remplace toute la population (sauf les élites).
+    GA_STEADY_STATE  ///< Chaque enfant remplace le pire individu s'il le dépasse.
+} GeneticMode;
+
+/**
+ * @brief Opérateur de croisement de `genetic_algorithm_config`.
+ */
+typedef enum {
+    CROSSOVER_ONE_POINT,     ///< Croisement en un point (comme `crossover`).
+    CROSSOVER_TWO_POINT,     ///< Le segment entre deux points vient du second parent.
+    CROSSOVER_UNIFORM,       ///< Chaque objet vient de l'un ou l'autre parent avec probabilité 1/2.
+    CROSSOVER_FITNESS_UNIFORM ///< Uniforme biaisé vers le meilleur parent (Chu-Beasley).
+} CrossoverType;
+
+/**
+ * @brief Opérateur de mutation de `genetic_algorithm_config`.
+ */
+typedef enum {
+    MUTATION_SINGLE_FLIP, ///< Avec probabilité `mutation_rate`, un objet inversé (rejeté s'il rend l'enfant infaisable).
+    MUTATION_PER_BIT      ///< Chaque objet est inversé avec probabilité `bit_mutation_rate`, puis l'enfant est réparé.
+} MutationMode;
+
+/**
+ * @brief Facteur d'adaptation du taux de mutation (règle du 1/5).
+ */
+#define GA_ADAPT_FACTOR 0.85
+
+/**
+ * @brief Paramètres de l'algorithme génétique (`genetic_algorithm_config`).
+ *
+ * Les deux tampons de population sont alloués une seule fois : les enfants sont écrits
+ * en place dans le tampon inactif, puis les tampons échangent leurs rôles à chaque génération.
+ */
+typedef struct {
+    int population_size;  ///< Taille de la population.
+    int generations;      ///< Nombre de générations (en mode stationnaire, `population_size` enfants par génération).
+    double mutation_rate; ///< Taux de mutation.
+    GeneticMode mode;     ///< Générationnel ou stationnaire.
+    int elitism;          ///< Nombre de meilleurs individus conservés à chaque génération (mode générationnel).
+    int vns_iterations;   ///< Itérations de VNS appliquées à chaque enfant (0 pour un génétique pur).
+    int k_perturbation;   ///< Intensité de la perturbation du VNS appliqué aux enfants.
+    CrossoverType crossover; ///< Opérateur de croisement.
+    int deduplicate;      ///< 1 pour rejeter les enfants déjà présents dans la population (empreintes de Zobrist).
+    MutationMode mutation_mode; ///< Opérateur de mutation.
+    double bit_mutation_rate;   ///< Probabilité initiale d'inversion par objet en mode `MUTATION_PER_BIT` (0 pour 1/n).
+    int adaptive_mutation; ///< 1 pour adapter le taux par objet à chaque génération (règle du 1/5, mode `MUTATION_PER_BIT` seulement).
+    int dual_repair;       ///< 1 pour réparer selon les pseudo-utilités duales de la relaxation linéaire (sinon le ratio du glouton).
+    double memetic_budget; ///< Temps (secondes) de recherche locale par génération, réparti entre les enfants (0 : VNS fixe sur chaque enfant).
+    double elite_fraction; ///< Fraction des meilleurs enfants éligibles à la recherche locale planifiée.
+    int archive_size;      ///< Capacité de l'archive d'élites pour le path relinking final (0 pour le désactiver).
+    double relinking_time; ///< Durée (secondes) du path relinking final, en plus de `time_limit` (0 : chaque paire une fois).
+} GeneticConfig;
+
 /**
  * @brief Initialisation d'un individu pour l'algorithme génétique.
  * 
@@ -67,9 +136,38 @@ void free_population(Individual *population, int population_size) ;
  void crossover(KnapsackSolution *parent1, KnapsackSolution *parent2, KnapsackSolution *child, const KnapsackInstance *instance);
  
  
+ /**
+  * @brief Recalcule le cache d'un individu (mots de bits, charges, Z et fitness) à partir de `solution->x`.
+  *
+  * @param individual L'individu, dont `bits` et `load` sont alloués.
+  * @param instance L'instance du problème.
+  */
+ void sync_individual(Individual *individual, const KnapsackInstance *instance);
+
+ /**
+  * @brief Croisement sur mots de 64 bits avec évaluation incrémentale.
+  *
+  * L'enfant part d'une copie d'un parent (solution, Z et charges en cache), puis seuls les
+  * objets où les parents diffèrent (`bits1 ^ bits2`) sont examinés ; chaque objet repris de
+  * l'autre parent met à jour Z et les charges en O(m). Lorsque la population converge, les
+  * parents diffèrent peu et le coût d'évaluation devient quasi nul.
+  *
+  * Pour `CROSSOVER_FITNESS_UNIFORM`, l'enfant part du meilleur parent et reprend chaque objet
+  * différent de l'autre avec probabilité f_autre / (f1 + f2). Un enfant infaisable est
+  * remplacé par le parent de départ.
+  *
+  * @param parent1 Le premier parent (cache à jour).
+  * @param parent2 Le second parent (cache à jour).
+  * @param child L'enfant, écrit en place (`bits` et `load` alloués).
+  * @param instance L'instance du problème.
+  * @param type L'opérateur de croisement.
+  */
+ void crossover_bits(const Individual *parent1, const Individual *parent2, Individual *child, const KnapsackInstance *instance, CrossoverType type);
+
  /**
   * Effectue une mutation sur une solution donnée avec un taux de mutation donné.
   * La mutation consiste à inverser un bit au hasard dans la solution si le taux de mutation est respecté.
+  * Le flip est annulé s'il rend la solution infaisable ; aucune allocation n'est effectuée.
   * 
   * @param solution La solution à muter.
   * @param instance L'instance du problème de sac à dos, contenant des informations comme le nombre d'objets.
@@ -78,6 +176,84 @@ void free_population(Individual *population, int population_size) ;
  void mutate(KnapsackSolution *solution, const KnapsackInstance *instance, double mutation_rate);
  
  
+ /**
+  * @brief Retourne la configuration par défaut de l'algorithme génétique.
+  *
+  * Mode générationnel sans élitisme ni VNS, comme `genetic_algorithm`.
+  *
+  * @return La configuration par défaut.
+  */
+ GeneticConfig default_genetic_config(void);
+
+ /**
+  * @brief Fixe les options de départ de `genetic_algorithm` et `hybrid_GA_VNS`.
+  *
+  * Les deux fonctions partent de ces options au lieu de `default_genetic_config`, puis
+  * imposent leurs propres paramètres (population, générations, taux de mutation, VNS) :
+  * mode stationnaire, élitisme, croisement, déduplication, mutation par objet, budget
+  * mémétique, etc. deviennent accessibles depuis `sadm_solver` et les grilles de
+  * `sadm_bench`. Le réglage est global : il doit être fait avant de lancer des threads.
+  *
+  * @param options Options copiées, ou `NULL` pour revenir à la configuration par défaut.
+  */
+ void configure_genetic_options(const GeneticConfig *options);
+
+ /**
+  * @brief Reconnaît une option de ligne de commande du génétique (`--ga-...`, `--memetic`, ...).
+  *
+  * @param argc Nombre d'arguments.
+  * @param argv Arguments.
+  * @param i Indice de l'option lue ; avancé sur sa valeur si elle en prend une.
+  * @param options Options mises à jour.
+  * @return 1 si l'option a été reconnue, 0 sinon.
+  */
+ int parse_genetic_option(int argc, char *argv[], int *i, GeneticConfig *options);
+
+ /**
+  * @brief Affiche l'aide des options reconnues par `parse_genetic_option`.
+  */
+ void print_genetic_options_usage(void);
+
+ /**
+  * @brief Exécute l'algorithme génétique (ou l'hybride GA + VNS si `vns_iterations > 0`) selon une configuration.
+  *
+  * Aucune allocation n'a lieu dans la boucle des générations : le coût d'une génération est
+  * celui des évaluations.
+  *
+  * Avec `deduplicate`, chaque individu porte une empreinte de Zobrist mise à jour en O(1)
+  * par objet inversé. Un enfant déjà présent (dans la génération en construction, ou dans
+  * la population en mode stationnaire) est reproduit à nouveau, jusqu'à
+  * `GA_DEDUP_ATTEMPTS` fois, avant de passer au VNS ; un doublon persistant n'est pas
+  * soumis au VNS (mode générationnel) ou est écarté (mode stationnaire). Deux solutions de
+  * même empreinte sont considérées identiques.
+  *
+  * En mode `MUTATION_PER_BIT`, les positions inversées sont tirées par sauts géométriques
+  * (coût proportionnel au nombre de flips, pas à n) et l'enfant passe ensuite par la
+  * réparation de Chu et Beasley (`repair_solution`) au lieu d'être rejeté. Avec
+  * `adaptive_mutation`, le taux est multiplié par `GA_ADAPT_FACTOR` si moins d'un enfant sur
+  * cinq dépasse ses deux parents, et divisé sinon (borné à [1/n, 0.5] par objet).
+  *
+  * Avec `vns_iterations > 0` et `memetic_budget > 0`, le VNS n'est plus appliqué à chaque
+  * enfant : en mode générationnel, seuls les enfants du premier `elite_fraction` de la
+  * génération et ceux qui dépassent leurs deux parents y ont droit, et `memetic_budget`
+  * secondes sont réparties entre eux selon leur rang (part linéairement décroissante,
+  * au plus `vns_iterations` itérations chacun). En mode stationnaire, seuls les enfants qui
+  * dépassent leurs parents sont améliorés, avec `memetic_budget / population_size` secondes
+  * chacun. Un individu déjà issu d'une recherche locale (élite recopiée, enfant identique à
+  * un parent amélioré) n'est pas traité à nouveau.
+  *
+  * Avec `archive_size > 0`, le meilleur individu de chaque génération et chaque individu
+  * issu d'une recherche locale sont proposés à une archive d'élites (`path_relinking.h`).
+  * En fin d'exécution, les membres de l'archive sont reliés deux à deux par path relinking
+  * (post-optimisation), et la meilleure solution de l'archive est retournée si elle est meilleure.
+  *
+  * @param instance L'instance du problème du sac à dos.
+  * @param config Les paramètres de l'algorithme.
+  * @param time_limit La limite de temps en secondes (0 pour illimité).
+  * @return La meilleure solution de la population finale, ou `NULL` en cas d'erreur d'allocation.
+  */
+ KnapsackSolution* genetic_algorithm_config(const KnapsackInstance *instance, const GeneticConfig *config, int time_limit);
+
  /**
   * Exécute l'algorithme génétique pour résoudre le problème du sac à dos.
   * L'algorithme effectue les étapes suivantes :
@@ -91,6 +267,8 @@ void free_population(Individual *population, int population_size) ;
   * @param population_size La taille de la population.
   * @param generations Le nombre de générations à exécuter.
   * @param mutation_rate Le taux de mutation.
+  * Les autres paramètres viennent de `configure_genetic_options` (sans VNS).
+  *
   * @param time_limit La limite de temps en secondes pour l'exécution de l'algorithme (0 pour illimité).
   * @return La meilleure solution trouvée à la fin des générations ou avant expiration du temps imparti.
   */
@@ -104,7 +282,10 @@ void free_population(Individual *population, int population_size) ;
  * Cet algorithme combine la recherche par génétique avec la recherche locale (VNS) pour optimiser
  * la solution du problème du sac à dos. Il utilise une population d'individus, effectue des croisements
  * et des mutations, puis applique un VNS sur chaque solution de la population pour améliorer les résultats.
- * Le processus se répète sur plusieurs générations.
+ * Le processus se répète sur plusieurs générations. Les autres paramètres viennent de
+ * `configure_genetic_options` ; avec un budget mémétique (`memetic_budget`), le VNS est
+ * réservé aux enfants d'élite ou meilleurs que leurs parents, selon un budget par génération ;
+ * avec une archive d'élites (`archive_size`), le path relinking sert de post-optimisation.
  *
  * @param instance Pointeur vers une instance du problème de sac à dos. Cela contient les paramètres nécessaires 
  *                 au problème (par exemple, les poids, les valeurs, la capacité, etc.).
@@ -1,6 +1,56 @@
 #include "heuristique.h"
-
-static const KnapsackInstance *q_sort_global_instance = NULL;
+#include <stdatomic.h>
+
+// Propre à chaque thread : plusieurs threads peuvent trier des instances différentes en même temps
+static _Thread_local const KnapsackInstance *q_sort_global_instance = NULL;
+
+// Réglages du voisinage swap parallèle (voir configure_parallel_swap)
+static ThreadPool *swap_pool = NULL;
+static int swap_parallel_min_items = 1000;
+static int swap_best_improvement = 0;
+
+// Meilleur couple trouvé par une tranche du voisinage swap
+typedef struct {
+    int delta;   // Gain de profit (0 si aucun couple améliorant)
+    int first;   // Plus petit indice du couple
+    int second;  // Plus grand indice du couple
+} SwapMove;
+
+typedef struct {
+    const KnapsackInstance *instance;
+    const int *x;
+    const int *slack;
+    int chunk_count;
+    int best_improvement;
+    SwapMove *moves;
+} SwapScan;
+
+static void local_search_swap_parallel(KnapsackSolution *solution, const KnapsackInstance *instance);
+
+// Échéance des descentes du thread (0 = aucune), vérifiée sans longjmp
+static _Thread_local TimeValue descent_start;
+static _Thread_local double descent_limit = 0;
+
+// Multiplicateurs de la clé d'efficacité (NULL : poids normalisés par les capacités)
+static double *efficiency_weights = NULL;
+static int efficiency_weights_count = 0;
+static atomic_int efficiency_mismatch_warned = 0;
+
+// Capacité du cache de VND (0 = désactivé) et compteurs cumulés du thread
+static int vnd_cache_capacity = 0;
+static _Thread_local VndCacheStats vnd_cache_totals = {0, 0, 0};
+
+// Cache de VND propre à une recherche
+typedef struct {
+    ZobristTable *zobrist;
+    SolutionCache cache;
+} VndMemo;
+
+// Cache de la VNS bornée, conservé d'un appel à l'autre dans le thread et libéré à sa fin
+static _Thread_local VndMemo *budget_memo = NULL;
+static _Thread_local const KnapsackInstance *budget_memo_instance = NULL;
+static pthread_key_t budget_memo_key;
+static pthread_once_t budget_memo_once = PTHREAD_ONCE_INIT;
 
 KnapsackSolution *random_initial_solution(const KnapsackInstance *instance)
 {
@@ -18,7 +68,7 @@ KnapsackSolution *random_initial_solution(const KnapsackInstance *instance)
     // Générer une solution aléatoire
     for (int i = 0; i < instance->n; i++)
     {
-        int object_index = rand() % instance->n; // Choisir un objet aléatoire
+        int object_index = rng_rand() % instance->n; // Choisir un objet aléatoire
         solution->x[object_index] = 1;           // Essayer d'ajouter l'objet à la solution
 
         // Vérifier la faisabilité de la solution
@@ -39,13 +89,13 @@ void random_construction(KnapsackSolution *solution, const KnapsackInstance *ins
 {
     for (int i = 0; i < instance->n; i++)
     {
-        solution->x[i] = rand() % 2; // 0 ou 1, objet sélectionné ou non
+        solution->x[i] = rng_rand() % 2; // 0 ou 1, objet sélectionné ou non
     }
 
     // Si la solution dépasse les capacités, retirer des objets aléatoirement
     while (!is_feasible(solution, instance))
     {
-        int rand_index = rand() % instance->n;
+        int rand_index = rng_rand() % instance->n;
         /**
          * Nous pourrions faire un tri sur les objets selectionner puis les retirer
          * mais pour respecter la construction aleatoire nous retirerons les objets de
@@ -62,29 +112,63 @@ void random_construction(KnapsackSolution *solution, const KnapsackInstance *ins
     evaluate_solution(solution, instance);
 }
 
-int compare_knapsack_instance(const void *a, const void *b) {
-    const KnapsackInstance *instance = q_sort_global_instance;
-
-    int index_a = *(int *)a;
-    int index_b = *(int *)b;
+void configure_efficiency_weights(const double *weights, int m)
+{
+    free(efficiency_weights);
+    efficiency_weights = NULL;
+    efficiency_weights_count = 0;
+    atomic_store(&efficiency_mismatch_warned, 0);
+    if (weights == NULL)
+    {
+        return;
+    }
+    efficiency_weights = (double *)malloc(m * sizeof(double));
+    if (!efficiency_weights)
+    {
+        perror("Erreur d'allocation mémoire (configure_efficiency_weights)");
+        exit(EXIT_FAILURE);
+    }
+    for (int k = 0; k < m; k++)
+    {
+        efficiency_weights[k] = weights[k];
+    }
+    efficiency_weights_count = m;
+}
 
-    // Calcul du ratio profit/poids pour chaque objet en prenant en compte toutes les contraintes
-    double total_weight_a = 0.0;
-    double total_weight_b = 0.0;
+double efficiency_ratio(const KnapsackInstance *instance, int i)
+{
+    double total_weight = 0.0;
+    if (efficiency_weights && efficiency_weights_count == instance->m)
+    {
+        // Poids agrégés par les multiplicateurs configurés
+        for (int j = 0; j < instance->m; j++)
+        {
+            total_weight += efficiency_weights[j] * instance->weights[j][i];
+        }
+        return (total_weight > 0) ? ((double)instance->profits[i] / total_weight) : instance->profits[i] * 1e12;
+    }
+    if (efficiency_weights && atomic_exchange(&efficiency_mismatch_warned, 1) == 0)
+    {
+        fprintf(stderr, "Clé d'efficacité configurée pour %d contraintes, instance à %d : critère par défaut\n", efficiency_weights_count, instance->m);
+    }
 
     // Somme des poids normalisés par les capacités pour chaque contrainte
     for (int j = 0; j < instance->m; j++)
     {
         if (instance->capacities[j] > 0) // Éviter la division par zéro
         {
-            total_weight_a += instance->weights[j][index_a] / (double)instance->capacities[j];
-            total_weight_b += instance->weights[j][index_b] / (double)instance->capacities[j];
+            total_weight += instance->weights[j][i] / (double)instance->capacities[j];
         }
     }
+    return (total_weight > 0) ? ((double)instance->profits[i] / total_weight) : 0;
+}
+
+int compare_knapsack_instance(const void *a, const void *b) {
+    const KnapsackInstance *instance = q_sort_global_instance;
 
-    // Calcul du ratio profit/poids
-    double ratio_a = (total_weight_a > 0) ? ((double)instance->profits[index_a] / total_weight_a) : 0;
-    double ratio_b = (total_weight_b > 0) ? ((double)instance->profits[index_b] / total_weight_b) : 0;
+    // Calcul du ratio profit/poids pour chaque objet en prenant en compte toutes les contraintes
+    double ratio_a = efficiency_ratio(instance, *(int *)a);
+    double ratio_b = efficiency_ratio(instance, *(int *)b);
 
     // Comparaison des ratios
     if (ratio_a > ratio_b)
@@ -94,15 +178,13 @@ int compare_knapsack_instance(const void *a, const void *b) {
     return 0; // Si les ratios sont égaux
 }
 
-KnapsackSolution *greedy_initial_solution(const KnapsackInstance *instance)
+int *efficiency_order(const KnapsackInstance *instance)
 {
-    KnapsackSolution *solution = init_solution(instance->n);
-
     // Crée un tableau d'indices pour trier les objets
     int *indices = (int *)malloc(instance->n * sizeof(int));
     if (!indices)
     {
-        perror("Erreur d'allocation mémoire pour indices (greedy_initial_solution)");
+        perror("Erreur d'allocation mémoire pour indices (efficiency_order)");
         exit(EXIT_FAILURE);
     }
     for (int i = 0; i < instance->n; i++)
@@ -114,6 +196,83 @@ KnapsackSolution *greedy_initial_solution(const KnapsackInstance *instance)
     // Définir la variable globale avant d'appeler qsort
     q_sort_global_instance = instance;
     qsort(indices, instance->n, sizeof(int), compare_knapsack_instance);
+    return indices;
+}
+
+void repair_solution(KnapsackSolution *solution, const KnapsackInstance *instance, const int *order)
+{
+    int *load = (int *)calloc(instance->m, sizeof(int));
+    if (!load)
+    {
+        perror("Erreur d'allocation mémoire pour load (repair_solution)");
+        exit(EXIT_FAILURE);
+    }
+    for (int k = 0; k < instance->m; k++)
+    {
+        for (int i = 0; i < instance->n; i++)
+        {
+            if (solution->x[i])
+            {
+                load[k] += instance->weights[k][i];
+            }
+        }
+    }
+
+    // Phase de retrait : les objets les moins efficaces d'abord
+    for (int r = instance->n - 1; r >= 0; r--)
+    {
+        int over = 0;
+        for (int k = 0; k < instance->m && !over; k++)
+        {
+            over = load[k] > instance->capacities[k];
+        }
+        if (!over)
+        {
+            break;
+        }
+        int i = order[r];
+        if (solution->x[i])
+        {
+            solution->x[i] = 0;
+            for (int k = 0; k < instance->m; k++)
+            {
+                load[k] -= instance->weights[k][i];
+            }
+        }
+    }
+
+    // Phase d'ajout : les objets les plus efficaces d'abord
+    for (int r = 0; r < instance->n; r++)
+    {
+        int i = order[r];
+        if (solution->x[i])
+        {
+            continue;
+        }
+        int fits = 1;
+        for (int k = 0; k < instance->m && fits; k++)
+        {
+            fits = load[k] + instance->weights[k][i] <= instance->capacities[k];
+        }
+        if (fits)
+        {
+            solution->x[i] = 1;
+            for (int k = 0; k < instance->m; k++)
+            {
+                load[k] += instance->weights[k][i];
+            }
+        }
+    }
+
+    free(load);
+    evaluate_solution(solution, instance);
+}
+
+KnapsackSolution *greedy_initial_solution(const KnapsackInstance *instance)
+{
+    KnapsackSolution *solution = init_solution(instance->n);
+
+    int *indices = efficiency_order(instance);
     // Copier les capacités pour ne pas modifier l'instance originale
     int *remaining_capacities = copy_capacities(instance);
     ;
@@ -146,6 +305,17 @@ KnapsackSolution *greedy_initial_solution(const KnapsackInstance *instance)
     return solution;
 }
 
+void set_descent_deadline(TimeValue start, double time_limit)
+{
+    descent_start = start;
+    descent_limit = time_limit > 0 ? time_limit : 0;
+}
+
+static int descent_deadline_passed(void)
+{
+    return descent_limit > 0 && time_exceeded(descent_start, descent_limit);
+}
+
 void local_search_1_flip(KnapsackSolution *solution, const KnapsackInstance *instance)
 {
     int improved = 1;
@@ -158,6 +328,10 @@ void local_search_1_flip(KnapsackSolution *solution, const KnapsackInstance *ins
         // Tester chaque objet en l'ajoutant ou en le retirant de la solution
         for (int i = 0; i < instance->n; i++)
         {
+            if (descent_deadline_passed())
+            {
+                return;
+            }
             // Sauvegarder l'ancienne valeur de la solution
             int old_Z = solution->Z;
 
@@ -194,6 +368,12 @@ void local_search_1_flip(KnapsackSolution *solution, const KnapsackInstance *ins
 
 void local_search_swap(KnapsackSolution *solution, const KnapsackInstance *instance)
 {
+    if (swap_pool != NULL && instance->n >= swap_parallel_min_items)
+    {
+        local_search_swap_parallel(solution, instance);
+        return;
+    }
+
     int improved = 1;
 
     // Continue la recherche tant qu'il y a des améliorations possibles
@@ -204,6 +384,10 @@ void local_search_swap(KnapsackSolution *solution, const KnapsackInstance *insta
         // Tester tous les échanges possibles
         for (int i = 0; i < instance->n; i++)
         {
+            if (descent_deadline_passed())
+            {
+                return;
+            }
             for (int j = i + 1; j < instance->n; j++)
             {
                 // Si un objet est sélectionné et l'autre ne l'est pas, on les échange
@@ -251,6 +435,136 @@ void local_search_swap(KnapsackSolution *solution, const KnapsackInstance *insta
 }
 
 
+void configure_parallel_swap(ThreadPool *pool, int min_items, int best_improvement)
+{
+    swap_pool = pool;
+    swap_parallel_min_items = min_items;
+    swap_best_improvement = best_improvement;
+}
+
+// Le couple (a, b) précède-t-il (c, d) dans l'ordre du parcours séquentiel ?
+static int swap_precedes(int a, int b, int c, int d)
+{
+    return a < c || (a == c && b < d);
+}
+
+// Parcourt les lignes i = chunk, chunk + chunk_count, ... (entrelacées pour équilibrer le triangle i < j)
+static void swap_scan_chunk(void *arg, int chunk)
+{
+    SwapScan *scan = (SwapScan *)arg;
+    const KnapsackInstance *instance = scan->instance;
+    const int *x = scan->x;
+    SwapMove best = {0, -1, -1};
+
+    for (int i = chunk; i < instance->n; i += scan->chunk_count)
+    {
+        for (int j = i + 1; j < instance->n; j++)
+        {
+            if (x[i] == x[j])
+            {
+                continue;
+            }
+            int out = x[i] ? i : j;
+            int in = x[i] ? j : i;
+            int delta = instance->profits[in] - instance->profits[out];
+            if (delta <= 0 || delta < best.delta || (delta == best.delta && !swap_precedes(i, j, best.first, best.second)))
+            {
+                continue;
+            }
+
+            // Faisabilité en O(m) contre les capacités restantes
+            int feasible = 1;
+            for (int k = 0; k < instance->m && feasible; k++)
+            {
+                feasible = scan->slack[k] + instance->weights[k][out] - instance->weights[k][in] >= 0;
+            }
+            if (feasible)
+            {
+                best.delta = delta;
+                best.first = i;
+                best.second = j;
+                if (!scan->best_improvement)
+                {
+                    // La première ligne de la tranche contenant un couple améliorant suffit
+                    break;
+                }
+            }
+        }
+        if (!scan->best_improvement && best.delta > 0)
+        {
+            break;
+        }
+    }
+    scan->moves[chunk] = best;
+}
+
+static void local_search_swap_parallel(KnapsackSolution *solution, const KnapsackInstance *instance)
+{
+    int chunk_count = swap_pool->thread_count * 2;
+    int *slack = (int *)malloc(instance->m * sizeof(int));
+    SwapMove *moves = (SwapMove *)malloc(chunk_count * sizeof(SwapMove));
+    if (!slack || !moves)
+    {
+        perror("Erreur d'allocation mémoire pour le voisinage swap (local_search_swap_parallel)");
+        exit(EXIT_FAILURE);
+    }
+
+    // Capacités restantes de la solution courante
+    for (int k = 0; k < instance->m; k++)
+    {
+        slack[k] = instance->capacities[k];
+        for (int i = 0; i < instance->n; i++)
+        {
+            if (solution->x[i] == 1)
+            {
+                slack[k] -= instance->weights[k][i];
+            }
+        }
+    }
+    evaluate_solution(solution, instance);
+
+    SwapScan scan = {instance, solution->x, slack, chunk_count, swap_best_improvement, moves};
+    while (!descent_deadline_passed())
+    {
+        thread_pool_parallel_for(swap_pool, chunk_count, swap_scan_chunk, &scan);
+
+        // Réduction : meilleur gain (ou premier couple) puis plus petits indices
+        SwapMove best = {0, -1, -1};
+        for (int c = 0; c < chunk_count; c++)
+        {
+            if (moves[c].delta <= 0)
+            {
+                continue;
+            }
+            int better = scan.best_improvement
+                             ? (moves[c].delta > best.delta || (moves[c].delta == best.delta && swap_precedes(moves[c].first, moves[c].second, best.first, best.second)))
+                             : (best.delta == 0 || swap_precedes(moves[c].first, moves[c].second, best.first, best.second));
+            if (better)
+            {
+                best = moves[c];
+            }
+        }
+        if (best.delta <= 0)
+        {
+            break;
+        }
+
+        // Appliquer l'unique mouvement retenu pour ce tour
+        int out = solution->x[best.first] ? best.first : best.second;
+        int in = solution->x[best.first] ? best.second : best.first;
+        solution->x[out] = 0;
+        solution->x[in] = 1;
+        solution->Z += best.delta;
+        for (int k = 0; k < instance->m; k++)
+        {
+            slack[k] += instance->weights[k][out] - instance->weights[k][in];
+        }
+    }
+
+    free(moves);
+    free(slack);
+}
+
 void variable_neighborhood_descent(KnapsackSolution *solution, const KnapsackInstance *instance, int time_limit)  {
     if (time_limit > 0) {
         timeout_flag = 0;
@@ -288,11 +602,138 @@ void variable_neighborhood_descent(KnapsackSolution *solution, const KnapsackIns
 }
 
 
+void configure_vnd_cache(int capacity)
+{
+    vnd_cache_capacity = capacity;
+}
+
+VndCacheStats vnd_cache_stats(void)
+{
+    VndCacheStats stats = vnd_cache_totals;
+    if (budget_memo != NULL)
+    {
+        stats.hits += budget_memo->cache.hits;
+        stats.misses += budget_memo->cache.misses;
+        stats.evictions += budget_memo->cache.evictions;
+    }
+    return stats;
+}
+
+static VndMemo *vnd_memo_create(int n)
+{
+    if (vnd_cache_capacity <= 0)
+    {
+        return NULL;
+    }
+    VndMemo *memo = (VndMemo *)malloc(sizeof(VndMemo));
+    if (!memo)
+    {
+        perror("Erreur d'allocation mémoire pour le cache de VND (vnd_memo_create)");
+        return NULL;
+    }
+    memo->zobrist = zobrist_create(n, 0xD1CEC0DEULL);
+    if (!memo->zobrist || solution_cache_init(&memo->cache, vnd_cache_capacity) != 0)
+    {
+        zobrist_free(memo->zobrist);
+        free(memo);
+        return NULL;
+    }
+    return memo;
+}
+
+static void vnd_memo_free(VndMemo *memo)
+{
+    if (memo != NULL)
+    {
+        vnd_cache_totals.hits += memo->cache.hits;
+        vnd_cache_totals.misses += memo->cache.misses;
+        vnd_cache_totals.evictions += memo->cache.evictions;
+        solution_cache_free(&memo->cache);
+        zobrist_free(memo->zobrist);
+        free(memo);
+    }
+}
+
+static void budget_memo_destroy(void *memo)
+{
+    vnd_memo_free((VndMemo *)memo);
+    budget_memo = NULL;
+}
+
+static void budget_memo_key_create(void)
+{
+    pthread_key_create(&budget_memo_key, budget_memo_destroy);
+}
+
+// Cache du thread pour `instance`, recréé si l'instance ou la capacité a changé
+static VndMemo *budget_memo_for(const KnapsackInstance *instance)
+{
+    if (budget_memo != NULL && (budget_memo_instance != instance || budget_memo->zobrist->n != instance->n || budget_memo->cache.capacity != vnd_cache_capacity))
+    {
+        vnd_memo_free(budget_memo);
+        budget_memo = NULL;
+        pthread_setspecific(budget_memo_key, NULL);
+    }
+    if (budget_memo == NULL && vnd_cache_capacity > 0)
+    {
+        budget_memo = vnd_memo_create(instance->n);
+        budget_memo_instance = instance;
+        pthread_once(&budget_memo_once, budget_memo_key_create);
+        pthread_setspecific(budget_memo_key, budget_memo);
+    }
+    return budget_memo;
+}
+
+// VND consultant le cache ; `best` est la meilleure solution de la recherche (NULL avant la première)
+static void memo_descent(VndMemo *memo, KnapsackSolution *solution, const KnapsackInstance *instance, const KnapsackSolution *best)
+{
+    if (memo == NULL)
+    {
+        variable_neighborhood_descent(solution, instance, 0);
+        return;
+    }
+
+    // Z à jour : le résultat de la VND ne dépend alors que de x
+    evaluate_solution(solution, instance);
+    unsigned long long key = zobrist_hash(memo->zobrist, solution->x);
+    int cached_Z;
+    unsigned long long cached_hash;
+    if (solution_cache_lookup(&memo->cache, key, &cached_Z, &cached_hash))
+    {
+        // Une nouvelle instance à la même adresse ne peut pas tromper ce test : Z vient d'être recalculé
+        if (cached_hash == key && cached_Z == solution->Z)
+        {
+            // Déjà un optimum local : la VND ne changerait rien
+            solution->Z = cached_Z;
+            return;
+        }
+        if (best != NULL && cached_Z <= best->Z)
+        {
+            // Optimum connu et non améliorant : la recherche reviendrait à `best`
+            copy_solution_into(solution, best, instance->n);
+            return;
+        }
+    }
+
+    variable_neighborhood_descent(solution, instance, 0);
+    if (descent_deadline_passed())
+    {
+        // Descente peut-être coupée par l'échéance : le résultat n'est pas un optimum local
+        return;
+    }
+    unsigned long long result_hash = zobrist_hash(memo->zobrist, solution->x);
+    solution_cache_store(&memo->cache, key, solution->Z, result_hash);
+    if (result_hash != key)
+    {
+        solution_cache_store(&memo->cache, result_hash, solution->Z, result_hash);
+    }
+}
+
 void random_flip(KnapsackSolution *solution, const KnapsackInstance *instance, int k_perturbation) {
 
     for (int p = 0; p < k_perturbation; p++) {
         // Choisir un objet aléatoire
-        int i = rand() % instance->n;
+        int i = rng_rand() % instance->n;
 
         // Inverser l'état de l'objet
         solution->x[i] = 1 - solution->x[i];
@@ -307,11 +748,17 @@ void random_flip(KnapsackSolution *solution, const KnapsackInstance *instance, i
 
 void variable_neighborhood_search(KnapsackSolution *solution, const KnapsackInstance *instance, int max_iterations, int k_perturbation, int time_limit) {
 
+    // Statique pour être libéré après un longjmp
+    static _Thread_local VndMemo *memo = NULL;
+    memo = vnd_memo_create(instance->n);
+
     if (time_limit > 0) {
         timeout_flag = 0;
         start_time = get_current_time();
         if (setjmp(env) != 0) {
             printf("Temps écoulé ! Arrêt de l'algorithme (variable_neighborhood_search).\n");
+            vnd_memo_free(memo);
+            memo = NULL;
             return;  // Sortir de la fonction si le temps est écoulé
         }
     }
@@ -320,27 +767,28 @@ void variable_neighborhood_search(KnapsackSolution *solution, const KnapsackInst
     // Initialiser la meilleure solution avec init_solution
     KnapsackSolution *best_solution = init_solution(instance->n);
 
-    while (iteration < max_iterations) {
+    // Arrêt anticipé dès que la meilleure solution atteint la cible
+    while (iteration < max_iterations && !target_reached(best_solution->Z)) {
         // Phase de VND
-        variable_neighborhood_descent(solution, instance, 0);
+        memo_descent(memo, solution, instance, NULL);
 
         // Sauvegarder la meilleure solution trouvée (copie profonde)
         if (solution->Z > best_solution->Z) {
-            copy_knapsack_solution(best_solution, solution, instance->n);
+            copy_solution_into(best_solution, solution, instance->n);
         }
 
         // Phase de perturbation
         random_flip(solution, instance, k_perturbation);
 
         // Phase de VND après perturbation
-        variable_neighborhood_descent(solution, instance, 0);
+        memo_descent(memo, solution, instance, best_solution);
 
         // Si la solution après perturbation est meilleure, la conserver
         if (solution->Z > best_solution->Z) {
-            copy_knapsack_solution(best_solution, solution, instance->n);
+            copy_solution_into(best_solution, solution, instance->n);
         } else {
             // Sinon, revenir à la meilleure solution précédente
-            copy_knapsack_solution(solution, best_solution, instance->n);
+            copy_solution_into(solution, best_solution, instance->n);
         }
 
         iteration++;
@@ -350,4 +798,33 @@ void variable_neighborhood_search(KnapsackSolution *solution, const KnapsackInst
 
     // Libérer la mémoire de la meilleure solution
     free_solution(best_solution);
-}
\ No newline at end of file
+    vnd_memo_free(memo);
+    memo = NULL;
+}
+
+int variable_neighborhood_search_budget(KnapsackSolution *solution, const KnapsackInstance *instance, int max_iterations, int k_perturbation, TimeValue start_time, double time_limit) {
+    KnapsackSolution *best_solution = init_solution(instance->n);
+    VndMemo *memo = budget_memo_for(instance);
+
+    memo_descent(memo, solution, instance, NULL);
+    copy_solution_into(best_solution, solution, instance->n);
+
+    int iteration = 0;
+    while (iteration < max_iterations && !time_exceeded(start_time, time_limit) && !target_reached(best_solution->Z)) {
+        // Phase de perturbation puis de VND
+        random_flip(solution, instance, k_perturbation);
+        evaluate_solution(solution, instance);
+        memo_descent(memo, solution, instance, best_solution);
+
+        // Acceptation si amélioration, sinon retour à la meilleure solution
+        if (solution->Z > best_solution->Z) {
+            copy_solution_into(best_solution, solution, instance->n);
+        } else {
+            copy_solution_into(solution, best_solution, instance->n);
+        }
+        iteration++;
+    }
+
+    free_solution(best_solution);
+    return iteration;
+}
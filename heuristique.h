@@ -3,6 +3,10 @@
 
 #include "knapsack.h"
 #include "chrono.h"
+#include "rng.h"
+#include "thread_pool.h"
+#include "solution_hash.h"
+#include "termination.h"
 #include <time.h>
 
 /**
@@ -70,6 +74,63 @@ KnapsackSolution *random_initial_solution(const KnapsackInstance *instance);
  */
 KnapsackSolution *greedy_initial_solution(const KnapsackInstance *instance);
 
+/**
+ * @brief Remplace la clé d'efficacité du glouton et de la réparation par des multiplicateurs de contraintes.
+ *
+ * Le critère par défaut correspond aux multiplicateurs 1/c[k]. Des multiplicateurs
+ * surrogate ou duaux (`surrogate.h`, `lp.h`) tiennent compte de la tension de chaque
+ * contrainte et donnent en général de meilleures solutions de départ. Le réglage est
+ * global : il doit être fait avant de lancer des threads.
+ *
+ * @param weights Multiplicateurs des m contraintes (copiés), ou `NULL` pour revenir au critère par défaut.
+ * @param m Nombre de contraintes (pour une instance d'un autre nombre de contraintes, le critère par défaut est utilisé avec un avertissement).
+ */
+void configure_efficiency_weights(const double *weights, int m);
+
+/**
+ * @brief Ratio profit/poids de l'objet i, selon la clé d'efficacité (critère du glouton).
+ *
+ * Par défaut, les poids sont normalisés par les capacités ; voir `configure_efficiency_weights`.
+ *
+ * @param instance Pointeur vers l'instance du problème.
+ * @param i Indice de l'objet.
+ * @return Le ratio, ou 0 si l'objet ne pèse rien.
+ */
+double efficiency_ratio(const KnapsackInstance *instance, int i);
+
+/**
+ * @brief Retourne les indices des objets triés par ratio profit/poids décroissant (même critère que le glouton).
+ *
+ * @param instance Pointeur vers l'instance du problème.
+ * @return Un tableau de `n` indices, à libérer avec `free`.
+ */
+int *efficiency_order(const KnapsackInstance *instance);
+
+/**
+ * @brief Opérateur de réparation de Chu et Beasley (retrait puis ajout).
+ *
+ * Tant que la solution est infaisable, les objets sélectionnés sont retirés du moins
+ * efficace au plus efficace ; puis les objets non sélectionnés sont ajoutés du plus
+ * efficace au moins efficace tant qu'ils tiennent. La solution est faisable et évaluée au retour.
+ *
+ * @param solution La solution à réparer (modifiée en place).
+ * @param instance Pointeur vers l'instance du problème.
+ * @param order Ordre des objets par efficacité décroissante (voir `efficiency_order`).
+ */
+void repair_solution(KnapsackSolution *solution, const KnapsackInstance *instance, const int *order);
+
+
+/**
+ * @brief Fixe l'échéance des recherches locales du thread courant (1-flip, swap, donc VND).
+ *
+ * Les recherches locales vérifient l'échéance avant chaque objet examiné et s'arrêtent en
+ * laissant une solution cohérente, sans `longjmp` : un pas de solveur ne dépasse plus son
+ * échéance de la durée d'une descente complète.
+ *
+ * @param start Départ de l'échéance.
+ * @param time_limit Durée en secondes à partir de `start` (0 pour supprimer l'échéance).
+ */
+void set_descent_deadline(TimeValue start, double time_limit);
 
 /**
  * @brief Applique la recherche locale 1-flip pour améliorer la solution actuelle.
@@ -93,6 +154,24 @@ void local_search_1_flip(KnapsackSolution *solution, const KnapsackInstance *ins
  */
 void local_search_swap(KnapsackSolution *solution, const KnapsackInstance *instance);
 
+/**
+ * @brief Configure l'évaluation parallèle du voisinage swap dans `local_search_swap`.
+ *
+ * Au-delà de `min_items` objets, chaque tour de `local_search_swap` calcule une fois le
+ * vecteur des capacités restantes, puis répartit l'espace des couples (retiré, ajouté)
+ * entre les threads du pool. Chaque thread évalue ses couples en O(m) contre ce vecteur
+ * (en lecture seule) et retient son meilleur couple améliorant, ou son premier. Les
+ * résultats sont réduits à un seul mouvement, appliqué avant le tour suivant.
+ *
+ * La réduction départage les ex aequo par indices croissants : en mode premier améliorant,
+ * le mouvement appliqué est exactement celui que choisirait le parcours séquentiel.
+ *
+ * @param pool Pool de threads à utiliser, ou `NULL` pour désactiver le mode parallèle.
+ * @param min_items Nombre d'objets à partir duquel le mode parallèle s'applique.
+ * @param best_improvement 1 pour appliquer le meilleur couple améliorant, 0 pour le premier.
+ */
+void configure_parallel_swap(ThreadPool *pool, int min_items, int best_improvement);
+
 /**
  * @brief Applique la méthode de descente de voisinage variable (VND) pour améliorer une solution du problème du sac à dos.
  *
@@ -132,6 +211,38 @@ void variable_neighborhood_descent(KnapsackSolution *solution, const KnapsackIns
 void random_flip(KnapsackSolution *solution, const KnapsackInstance *instance, int k_perturbation);
 
 
+/**
+ * @brief Compteurs du cache de VND (cumulés sur toutes les recherches du thread courant).
+ */
+typedef struct {
+    long hits;      ///< Descentes évitées grâce au cache.
+    long misses;    ///< Descentes effectivement calculées.
+    long evictions; ///< Entrées évincées (LRU).
+} VndCacheStats;
+
+/**
+ * @brief Active le cache des optima de VND dans `variable_neighborhood_search` et sa variante bornée.
+ *
+ * Chaque recherche associe l'empreinte de Zobrist de la solution perturbée à l'optimum local
+ * obtenu par VND (valeur et empreinte), dans un cache LRU de `capacity` entrées. Si une
+ * perturbation retombe sur une solution déjà descendue, la VND n'est pas relancée : soit la
+ * solution est déjà un optimum local, soit son optimum ne dépasse pas la meilleure solution
+ * (sinon il aurait été adopté) et la recherche revient directement à celle-ci. Une descente
+ * coupée par l'échéance (`set_descent_deadline`) n'est pas enregistrée. Dans la variante
+ * bornée, une entrée peut venir d'un appel précédent : le retour à la meilleure solution
+ * coûte alors au plus une perturbation perdue, la solution restant réalisable.
+ *
+ * @param capacity Nombre maximal d'entrées du cache de chaque recherche (0 pour désactiver).
+ */
+void configure_vnd_cache(int capacity);
+
+/**
+ * @brief Retourne les compteurs du cache de VND du thread courant.
+ *
+ * @return Les compteurs cumulés depuis le début du programme.
+ */
+VndCacheStats vnd_cache_stats(void);
+
 /**
  * @brief Algorithme de recherche à voisinage variable (VNS) pour le problème du sac à dos.
  *
@@ -157,4 +268,27 @@ void random_flip(KnapsackSolution *solution, const KnapsackInstance *instance, i
 void variable_neighborhood_search(KnapsackSolution *solution, const KnapsackInstance *instance, int max_iterations, int k_perturbation, int time_limit);
 
 
+/**
+ * @brief Variante du VNS bornée par un nombre d'itérations et une échéance, sans `longjmp`.
+ *
+ * Même schéma que `variable_neighborhood_search` (VND, perturbation, VND, acceptation),
+ * mais le temps est vérifié entre deux itérations avec `time_exceeded` : la fonction
+ * peut donc être appelée depuis plusieurs threads à la fois, et la solution passée en
+ * paramètre contient toujours la meilleure solution trouvée au retour.
+ *
+ * Appelée une fois par enfant ou par créneau mémétique, elle réutilise le cache de VND du
+ * thread d'un appel à l'autre (recréé seulement si l'instance ou la capacité change, libéré
+ * à la fin du thread) : les optima déjà descendus restent connus entre les appels.
+ *
+ * @param solution Pointeur vers la solution initiale, remplacée par la meilleure solution trouvée.
+ * @param instance Pointeur vers l'instance du problème.
+ * @param max_iterations Nombre maximum d'itérations du VNS.
+ * @param k_perturbation Intensité de la perturbation.
+ * @param start_time Temps de départ de l'échéance.
+ * @param time_limit Durée maximale en secondes à partir de `start_time` (0 pour illimité).
+ * @return Le nombre d'itérations effectuées.
+ */
+int variable_neighborhood_search_budget(KnapsackSolution *solution, const KnapsackInstance *instance, int max_iterations, int k_perturbation, TimeValue start_time, double time_limit);
+
+
 #endif // HEURISTIQUE_H
@@ -0,0 +1,210 @@
+#include "kernel.h"
+#include "bnb.h"
+#include "dp.h"
+#include <string.h>
+
+// Un tour : les paquets partent tous de la même meilleure solution
+typedef struct {
+    const KnapsackInstance *instance;
+    const KernelConfig *config;
+    const KnapsackSolution *best;
+    const int *order;          // Objets par |coût réduit| croissant
+    int bucket_count;
+    int random_buckets;        // 1 une fois tous les paquets parcourus sans amélioration
+    long first_task;           // Rang global du premier paquet du tour
+    TimeValue start;
+    double time_limit;
+    KnapsackSolution **results; // Meilleure solution de chaque paquet du tour
+} KernelRound;
+
+KernelConfig default_kernel_config(void)
+{
+    KernelConfig config;
+    config.kernel_size = 20;
+    config.bucket_size = 20;
+    config.buckets_per_round = 4;
+    config.node_limit = 20000;
+    config.rounds = 1000000;
+    config.stall_rounds = 10;
+    config.seed = 1;
+    config.pool = NULL;
+    return config;
+}
+
+// Résout exactement le voisinage « noyau + paquet » autour de la meilleure solution
+static void solve_bucket(void *arg, int index)
+{
+    KernelRound *round = (KernelRound *)arg;
+    const KnapsackInstance *instance = round->instance;
+    const KernelConfig *config = round->config;
+    int n = instance->n;
+    int kernel = config->kernel_size < n ? config->kernel_size : n;
+    long task = round->first_task + index;
+
+    int *fixed = (int *)malloc(n * sizeof(int));
+    if (!fixed)
+    {
+        perror("Erreur d'allocation mémoire (solve_bucket)");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < n; i++)
+    {
+        fixed[i] = round->best->x[i];
+    }
+    for (int r = 0; r < kernel; r++)
+    {
+        fixed[round->order[r]] = -1;
+    }
+    int outside = n - kernel;
+    if (!round->random_buckets)
+    {
+        int first = kernel + (int)(task % round->bucket_count) * config->bucket_size;
+        for (int r = first; r < first + config->bucket_size && r < n; r++)
+        {
+            fixed[round->order[r]] = -1;
+        }
+    }
+    else if (outside > 0)
+    {
+        // Tirage sans remise (Floyd) : les objets hors noyau déjà tirés valent -1
+        RngState rng;
+        rng_seed(&rng, rng_derive(config->seed, (unsigned long long)task));
+        int picks = config->bucket_size < outside ? config->bucket_size : outside;
+        for (int j = outside - picks; j < outside; j++)
+        {
+            int t = rng_int(&rng, j + 1);
+            int item = round->order[kernel + (fixed[round->order[kernel + t]] < 0 ? j : t)];
+            fixed[item] = -1;
+        }
+    }
+
+    // Problème restreint, dont la restriction de la meilleure solution est réalisable
+    ReducedProblem restricted;
+    restrict_problem(instance, fixed, NULL, &restricted);
+    KnapsackSolution *current = init_solution(restricted.core.n);
+    for (int j = 0; j < restricted.core.n; j++)
+    {
+        current->x[j] = round->best->x[restricted.map[j]];
+        current->Z += current->x[j] ? restricted.core.profits[j] : 0;
+    }
+
+    KnapsackSolution *solved = restricted.core.m <= 2 ? dp_solve(&restricted.core, DP_MEMORY_LIMIT) : NULL;
+    if (solved == NULL)
+    {
+        BnbConfig bnb = default_bnb_config();
+        bnb.node_limit = config->node_limit;
+        bnb.initial = current;
+        if (round->time_limit > 0)
+        {
+            double remaining = round->time_limit - get_elapsed_time(round->start, get_current_time());
+            bnb.time_limit = remaining > 1e-3 ? remaining : 1e-3;
+        }
+        BnbResult exact;
+        bnb_solve(&restricted.core, &bnb, &exact);
+        solved = exact.best;
+        exact.best = NULL;
+        bnb_free(&exact);
+    }
+    if (solved->Z > current->Z)
+    {
+        round->results[index] = expand_solution(&restricted, solved);
+    }
+
+    free_solution(solved);
+    free_solution(current);
+    reduced_problem_free(&restricted);
+    free(fixed);
+}
+
+KnapsackSolution *kernel_search(const KnapsackInstance *instance, const KernelConfig *config, double time_limit)
+{
+    TimeValue start = get_current_time();
+    int n = instance->n;
+    KnapsackSolution *best = greedy_dual_solution(instance);
+    variable_neighborhood_descent(best, instance, 0);
+
+    // Noyau : les objets les plus proches de la frontière de la relaxation
+    int *order;
+    LpRelaxation lp;
+    if (lp_solve(instance, NULL, &lp) == 0)
+    {
+        order = (int *)malloc(n * sizeof(int));
+        if (!order)
+        {
+            perror("Erreur d'allocation mémoire (kernel_search)");
+            exit(EXIT_FAILURE);
+        }
+        for (int i = 0; i < n; i++)
+        {
+            order[i] = i;
+        }
+        reduced_cost_order(lp.reduced_costs, order, n);
+    }
+    else
+    {
+        order = efficiency_order(instance);
+    }
+    lp_free(&lp);
+
+    int parallel = config->buckets_per_round > 0 ? config->buckets_per_round : 1;
+    KnapsackSolution **results = (KnapsackSolution **)calloc(parallel, sizeof(KnapsackSolution *));
+    if (!results)
+    {
+        perror("Erreur d'allocation mémoire (kernel_search)");
+        exit(EXIT_FAILURE);
+    }
+    int kernel = config->kernel_size < n ? config->kernel_size : n;
+    int bucket_count = config->bucket_size > 0 ? (n - kernel + config->bucket_size - 1) / config->bucket_size : 0;
+    KernelRound round = {instance, config, best, order, bucket_count > 0 ? bucket_count : 1, bucket_count == 0, 0, start, time_limit, results};
+
+    // Noyau couvrant tous les objets : une seule résolution exacte, qu'un autre tour répéterait
+    int tasks = kernel < n ? parallel : 1;
+    long last_improvement = 0;
+    int stalled = 0;
+    for (int r = 0; r < config->rounds && !time_exceeded(start, time_limit) && !target_reached(best->Z); r++)
+    {
+        round.first_task = (long)r * parallel;
+        thread_pool_parallel_for(config->pool, tasks, solve_bucket, &round);
+
+        // Meilleure amélioration du tour (le premier paquet en cas d'égalité)
+        int chosen = -1;
+        for (int j = 0; j < parallel; j++)
+        {
+            if (results[j] && results[j]->Z > best->Z && (chosen < 0 || results[j]->Z > results[chosen]->Z))
+            {
+                chosen = j;
+            }
+        }
+        if (chosen >= 0)
+        {
+            copy_solution_into(best, results[chosen], n);
+            last_improvement = round.first_task + parallel;
+            stalled = 0;
+        }
+        else if (!round.random_buckets && round.first_task + parallel - last_improvement >= round.bucket_count)
+        {
+            // Tous les paquets parcourus depuis la dernière amélioration
+            round.random_buckets = 1;
+        }
+        else if (round.random_buckets)
+        {
+            stalled++;
+        }
+        for (int j = 0; j < tasks; j++)
+        {
+            if (results[j])
+            {
+                free_solution(results[j]);
+                results[j] = NULL;
+            }
+        }
+        if (kernel >= n || (config->stall_rounds > 0 && stalled >= config->stall_rounds))
+        {
+            break;
+        }
+    }
+
+    free(results);
+    free(order);
+    return best;
+}
@@ -0,0 +1,56 @@
+#ifndef KERNEL_H
+#define KERNEL_H
+
+#include "core.h"
+#include "thread_pool.h"
+
+/**
+ * @brief Paramètres de la recherche par noyau (grand voisinage résolu exactement).
+ *
+ * Les objets sont ordonnés par |coût réduit| LP croissant (par efficacité décroissante si
+ * la relaxation échoue). Les `kernel_size` premiers forment le noyau, les suivants sont
+ * découpés en paquets de `bucket_size` objets. Un voisinage libère le noyau et un paquet,
+ * fixe tous les autres objets à leur valeur dans la meilleure solution, et résout exactement
+ * le problème restreint (`dp_solve` si m <= 2 et la table tient en mémoire, sinon
+ * `bnb_solve` partant de la solution courante, limité à `node_limit` nœuds).
+ *
+ * Une fois tous les paquets parcourus sans amélioration, les paquets sont tirés au hasard
+ * (sans remise) parmi les objets hors noyau ; la recherche s'arrête après `stall_rounds`
+ * tours aléatoires consécutifs sans amélioration. Un noyau qui couvre tous les objets est
+ * résolu une seule fois.
+ */
+typedef struct {
+    int kernel_size;       ///< Nombre d'objets du noyau, libérés dans chaque voisinage.
+    int bucket_size;       ///< Nombre d'objets de chaque paquet.
+    int buckets_per_round; ///< Paquets résolus en parallèle à chaque tour.
+    long node_limit;       ///< Nœuds maximaux par résolution exacte (0 pour illimité).
+    int rounds;            ///< Nombre maximal de tours.
+    int stall_rounds;      ///< Tours aléatoires sans amélioration avant l'arrêt (0 : jamais).
+    unsigned long long seed; ///< Graine des paquets aléatoires.
+    ThreadPool *pool;      ///< Pool pour résoudre les paquets d'un tour en parallèle (`NULL` : séquentiel).
+} KernelConfig;
+
+/**
+ * @brief Retourne la configuration par défaut (noyau de 20 objets, paquets de 20, 4 paquets par tour, arrêt après 10 tours aléatoires sans amélioration).
+ *
+ * @return La configuration par défaut.
+ */
+KernelConfig default_kernel_config(void);
+
+/**
+ * @brief Exécute la recherche par noyau jusqu'au nombre de tours, à la stagnation ou à l'échéance.
+ *
+ * La solution de départ est le glouton dual amélioré par VND. À chaque tour, les paquets
+ * sont résolus indépendamment à partir de la même meilleure solution, puis le thread
+ * appelant retient la meilleure amélioration. Chaque paquet aléatoire a un générateur
+ * dérivé de la graine et de son rang : le résultat ne dépend pas du nombre de threads
+ * (sauf arrêt sur échéance).
+ *
+ * @param instance Instance du problème.
+ * @param config Paramètres de la recherche.
+ * @param time_limit Durée maximale en secondes (0 pour illimité), partagée avec les résolutions exactes.
+ * @return La meilleure solution trouvée (à libérer avec `free_solution`).
+ */
+KnapsackSolution *kernel_search(const KnapsackInstance *instance, const KernelConfig *config, double time_limit);
+
+#endif // KERNEL_H
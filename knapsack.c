@@ -164,6 +164,13 @@ void copy_knapsack_solution(KnapsackSolution *dest, const KnapsackSolution *src,
     }
 }
 
+void copy_solution_into(KnapsackSolution *dest, const KnapsackSolution *src, int n) {
+    dest->Z = src->Z;
+    for (int i = 0; i < n; i++) {
+        dest->x[i] = src->x[i];
+    }
+}
+
 void reset_solution(KnapsackSolution *solution, int n)
 {
     // Réinitialisation de la solution à zéro (aucun objet sélectionné)
@@ -88,6 +88,19 @@ KnapsackSolution *init_solution(int n);
  */
 void copy_knapsack_solution(KnapsackSolution *dest, const KnapsackSolution *src, int n);
 
+/**
+ * @brief Copie une solution dans une solution déjà allouée.
+ *
+ * Contrairement à `copy_knapsack_solution`, cette fonction n'alloue rien : elle recopie
+ * `src->x` dans le tableau `dest->x` existant (qui doit contenir au moins `n` éléments).
+ * Elle est destinée aux boucles chaudes où la même solution est écrasée à chaque itération.
+ *
+ * @param dest Pointeur vers la solution de destination (déjà initialisée via `init_solution`).
+ * @param src Pointeur vers la solution source.
+ * @param n Nombre d'objets dans l'instance du problème (taille du tableau `x`).
+ */
+void copy_solution_into(KnapsackSolution *dest, const KnapsackSolution *src, int n);
+
 /**
  * @brief Réinitialise la solution en mettant tous les objets à zéro et en réinitialisant la valeur de la solution.
  *
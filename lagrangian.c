@@ -0,0 +1,126 @@
+#include "lagrangian.h"
+#include <string.h>
+
+#define LAGRANGIAN_MIN_THETA 1e-4
+
+void lagrangian_solve(const KnapsackInstance *instance, int max_iterations, int patience, double time_limit, LagrangianResult *result)
+{
+    TimeValue start = get_current_time();
+    int n = instance->n;
+    int m = instance->m;
+
+    memset(result, 0, sizeof(LagrangianResult));
+    result->multipliers = (double *)calloc(m, sizeof(double));
+    double *lambda = (double *)calloc(m, sizeof(double));
+    double *reduced = (double *)malloc(n * sizeof(double));
+    double *subgradient = (double *)malloc(m * sizeof(double));
+    if (!result->multipliers || !lambda || !reduced || !subgradient)
+    {
+        perror("Erreur d'allocation mémoire (lagrangian_solve)");
+        exit(EXIT_FAILURE);
+    }
+    result->best = greedy_initial_solution(instance);
+    KnapsackSolution *candidate = init_solution(n);
+    result->bound = -1.0;
+
+    double theta = 2.0;
+    int stalled = 0;
+    for (int it = 0; it < max_iterations && !time_exceeded(start, time_limit) && !target_reached(result->best->Z); it++)
+    {
+        // Coûts réduits : une ligne de poids contiguë par contrainte (boucles vectorisables)
+        for (int i = 0; i < n; i++)
+        {
+            reduced[i] = instance->profits[i];
+        }
+        double value = 0.0;
+        for (int k = 0; k < m; k++)
+        {
+            const int *row = instance->weights[k];
+            double l = lambda[k];
+            for (int i = 0; i < n; i++)
+            {
+                reduced[i] -= l * row[i];
+            }
+            value += l * instance->capacities[k];
+        }
+
+        // Sous-problème : chaque objet de coût réduit positif est pris
+        for (int i = 0; i < n; i++)
+        {
+            int take = reduced[i] > 0;
+            candidate->x[i] = take;
+            value += take ? reduced[i] : 0.0;
+        }
+        result->iterations++;
+        if (result->bound < 0 || value < result->bound - 1e-9)
+        {
+            result->bound = value;
+            memcpy(result->multipliers, lambda, m * sizeof(double));
+            stalled = 0;
+        }
+        else if (++stalled >= patience)
+        {
+            theta /= 2;
+            stalled = 0;
+            if (theta < LAGRANGIAN_MIN_THETA)
+            {
+                break;
+            }
+        }
+
+        // Sous-gradient c - W.x (produits scalaires sur les lignes contiguës)
+        double norm = 0.0;
+        for (int k = 0; k < m; k++)
+        {
+            const int *row = instance->weights[k];
+            long load = 0;
+            for (int i = 0; i < n; i++)
+            {
+                load += row[i] * candidate->x[i];
+            }
+            subgradient[k] = instance->capacities[k] - (double)load;
+            norm += subgradient[k] * subgradient[k];
+        }
+
+        // Solution réalisable : réparation selon les pseudo-utilités courantes
+        int *order = dual_utility_order(instance, lambda);
+        repair_solution(candidate, instance, order);
+        free(order);
+        if (candidate->Z > result->best->Z)
+        {
+            copy_solution_into(result->best, candidate, n);
+        }
+        if (norm == 0.0 || value - result->best->Z < 1.0)
+        {
+            // Sous-problème réalisable et saturé, ou borne atteinte par une solution (profits entiers)
+            break;
+        }
+
+        // Pas de Polyak, projection sur lambda >= 0
+        double step = theta * (value - result->best->Z) / norm;
+        for (int k = 0; k < m; k++)
+        {
+            lambda[k] -= step * subgradient[k];
+            if (lambda[k] < 0)
+            {
+                lambda[k] = 0;
+            }
+        }
+    }
+
+    free_solution(candidate);
+    free(lambda);
+    free(reduced);
+    free(subgradient);
+}
+
+void lagrangian_free(LagrangianResult *result)
+{
+    free(result->multipliers);
+    result->multipliers = NULL;
+    if (result->best)
+    {
+        free_solution(result->best);
+        result->best = NULL;
+    }
+}
@@ -0,0 +1,50 @@
+#ifndef LAGRANGIAN_H
+#define LAGRANGIAN_H
+
+#include "lp.h"
+
+/**
+ * @brief Résultat de la relaxation lagrangienne.
+ *
+ * Les m contraintes de capacité sont dualisées avec des multiplicateurs lambda >= 0 :
+ * L(lambda) = sum_k lambda[k] c[k] + sum_i max(0, p[i] - sum_k lambda[k] W[k][i]) est une
+ * borne supérieure, et le sous-problème se résout objet par objet (x[i] = 1 si son coût
+ * réduit est positif). Le problème ayant la propriété d'intégralité, le minimum de L est
+ * la borne LP : la relaxation la retrouve sans simplexe, en O(n·m) par itération.
+ */
+typedef struct {
+    double bound;           ///< Meilleure (plus petite) borne L(lambda) obtenue.
+    double *multipliers;    ///< Multiplicateurs ayant donné `bound` (m valeurs).
+    KnapsackSolution *best; ///< Meilleure solution réalisable obtenue par réparation des sous-problèmes.
+    int iterations;         ///< Nombre d'itérations du sous-gradient.
+} LagrangianResult;
+
+/**
+ * @brief Optimise les multiplicateurs par sous-gradient (pas de Polyak) et répare chaque sous-problème.
+ *
+ * À chaque itération, le pas vaut theta × (L(lambda) - meilleure valeur réalisable) / ||g||²,
+ * g étant le sous-gradient (c - W.x) ; theta est divisé par deux après `patience` itérations
+ * sans amélioration de la borne. La solution du sous-problème est réparée (retrait puis ajout,
+ * voir `repair_solution`) en suivant les pseudo-utilités p[i] / (lambda.W[.][i]).
+ *
+ * La borne est l'intérêt principal. Une réparation est déjà un optimum local pour 1-flip et
+ * swap, et la meilleure reste à 0,3-1,9 % de la borne sur les instances fournies, à peine
+ * mieux que `greedy_dual_solution` : c'est un point de départ pour une autre méthode, pas
+ * une solution finale.
+ *
+ * @param instance Instance du problème.
+ * @param max_iterations Nombre maximal d'itérations.
+ * @param patience Itérations sans amélioration avant de diviser theta par deux.
+ * @param time_limit Durée maximale en secondes (0 pour illimité).
+ * @param result Résultat, alloué par la fonction (à libérer avec `lagrangian_free`).
+ */
+void lagrangian_solve(const KnapsackInstance *instance, int max_iterations, int patience, double time_limit, LagrangianResult *result);
+
+/**
+ * @brief Libère le résultat d'une relaxation lagrangienne.
+ *
+ * @param result Résultat à libérer.
+ */
+void lagrangian_free(LagrangianResult *result);
+
+#endif // LAGRANGIAN_H
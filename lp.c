@@ -0,0 +1,298 @@
+#include "lp.h"
+#include <math.h>
+#include <string.h>
+
+#define LP_EPSILON 1e-9
+#define LP_AT_LOWER 0
+#define LP_AT_UPPER 1
+#define LP_BASIC 2
+
+// Pseudo-utilités de référence pour qsort (propres à chaque thread)
+static _Thread_local const double *sort_utilities = NULL;
+
+static int compare_utilities(const void *a, const void *b)
+{
+    double ua = sort_utilities[*(const int *)a];
+    double ub = sort_utilities[*(const int *)b];
+    if (ua != ub)
+    {
+        return (ua < ub) - (ua > ub);
+    }
+    return *(const int *)a - *(const int *)b;
+}
+
+int lp_solve(const KnapsackInstance *instance, const int *fixed, LpRelaxation *lp)
+{
+    int n = instance->n;
+    int m = instance->m;
+    int cols = n + m; // Objets puis variables d'écart
+
+    memset(lp, 0, sizeof(LpRelaxation));
+    lp->x = (double *)calloc(n, sizeof(double));
+    lp->duals = (double *)calloc(m, sizeof(double));
+    lp->reduced_costs = (double *)calloc(n, sizeof(double));
+    double *tableau = (double *)malloc((size_t)m * cols * sizeof(double));
+    double *values = (double *)malloc(m * sizeof(double));  // Valeur des variables de base
+    double *reduced = (double *)malloc(cols * sizeof(double));
+    double *upper = (double *)malloc(cols * sizeof(double));
+    int *basis = (int *)malloc(m * sizeof(int));
+    int *state = (int *)malloc(cols * sizeof(int));
+    if (!lp->x || !lp->duals || !lp->reduced_costs || !tableau || !values || !reduced || !upper || !basis || !state)
+    {
+        perror("Erreur d'allocation mémoire (lp_solve)");
+        exit(EXIT_FAILURE);
+    }
+
+    // Base initiale : les écarts, les objets hors base à 0 (les objets fixés à 1 consomment la capacité)
+    double fixed_profit = 0.0;
+    for (int k = 0; k < m; k++)
+    {
+        values[k] = instance->capacities[k];
+    }
+    for (int i = 0; i < n; i++)
+    {
+        state[i] = LP_AT_LOWER;
+        upper[i] = (fixed && fixed[i] >= 0) ? 0.0 : 1.0;
+        reduced[i] = instance->profits[i];
+        if (fixed && fixed[i] == 1)
+        {
+            fixed_profit += instance->profits[i];
+            for (int k = 0; k < m; k++)
+            {
+                values[k] -= instance->weights[k][i];
+            }
+        }
+    }
+    lp->status = LP_OPTIMAL;
+    for (int k = 0; k < m; k++)
+    {
+        double *row = &tableau[(size_t)k * cols];
+        for (int i = 0; i < n; i++)
+        {
+            row[i] = instance->weights[k][i];
+        }
+        memset(&row[n], 0, m * sizeof(double));
+        row[n + k] = 1.0;
+        basis[k] = n + k;
+        state[n + k] = LP_BASIC;
+        reduced[n + k] = 0.0;
+        upper[n + k] = HUGE_VAL;
+        if (values[k] < 0)
+        {
+            lp->status = LP_INFEASIBLE;
+        }
+    }
+
+    int max_iterations = 50 * cols;
+    int degenerate = 0;
+    while (lp->status == LP_OPTIMAL)
+    {
+        // Variable entrante : règle de Dantzig, puis de Bland après une suite de pas dégénérés
+        int entering = -1;
+        double best_score = LP_EPSILON;
+        for (int j = 0; j < cols; j++)
+        {
+            double score = 0.0;
+            if (state[j] == LP_AT_LOWER && upper[j] > 0)
+            {
+                score = reduced[j];
+            }
+            else if (state[j] == LP_AT_UPPER)
+            {
+                score = -reduced[j];
+            }
+            if (score > best_score)
+            {
+                entering = j;
+                best_score = score;
+                if (degenerate > 50)
+                {
+                    break;
+                }
+            }
+        }
+        if (entering < 0)
+        {
+            break;
+        }
+        if (lp->iterations++ >= max_iterations)
+        {
+            lp->status = LP_ITERATION_LIMIT;
+            break;
+        }
+
+        // Test du ratio : une variable de base atteint une borne, ou l'entrante change de borne
+        double direction = state[entering] == LP_AT_LOWER ? 1.0 : -1.0;
+        double step = upper[entering];
+        int leaving_row = -1;
+        for (int k = 0; k < m; k++)
+        {
+            double alpha = direction * tableau[(size_t)k * cols + entering];
+            double limit;
+            if (alpha > LP_EPSILON)
+            {
+                limit = values[k] / alpha;
+            }
+            else if (alpha < -LP_EPSILON && upper[basis[k]] < HUGE_VAL)
+            {
+                limit = (upper[basis[k]] - values[k]) / -alpha;
+            }
+            else
+            {
+                continue;
+            }
+            if (limit < step)
+            {
+                step = limit;
+                leaving_row = k;
+            }
+        }
+        degenerate = step < LP_EPSILON ? degenerate + 1 : 0;
+
+        for (int k = 0; k < m; k++)
+        {
+            values[k] -= direction * step * tableau[(size_t)k * cols + entering];
+        }
+        if (leaving_row < 0)
+        {
+            // Changement de borne sans pivot
+            state[entering] = state[entering] == LP_AT_LOWER ? LP_AT_UPPER : LP_AT_LOWER;
+            continue;
+        }
+
+        int leaving = basis[leaving_row];
+        double pivot = tableau[(size_t)leaving_row * cols + entering];
+        state[leaving] = direction * pivot > 0 ? LP_AT_LOWER : LP_AT_UPPER;
+        values[leaving_row] = direction > 0 ? step : upper[entering] - step;
+        basis[leaving_row] = entering;
+        state[entering] = LP_BASIC;
+
+        // Pivot sur la ligne sortante
+        double *pivot_row = &tableau[(size_t)leaving_row * cols];
+        for (int j = 0; j < cols; j++)
+        {
+            pivot_row[j] /= pivot;
+        }
+        for (int k = 0; k < m; k++)
+        {
+            double factor = tableau[(size_t)k * cols + entering];
+            if (k == leaving_row || factor == 0.0)
+            {
+                continue;
+            }
+            double *row = &tableau[(size_t)k * cols];
+            for (int j = 0; j < cols; j++)
+            {
+                row[j] -= factor * pivot_row[j];
+            }
+        }
+        double factor = reduced[entering];
+        for (int j = 0; j < cols; j++)
+        {
+            reduced[j] -= factor * pivot_row[j];
+        }
+    }
+
+    if (lp->status != LP_INFEASIBLE)
+    {
+        // Primal, duales (opposées des coûts réduits des écarts) et coûts réduits des objets
+        for (int i = 0; i < n; i++)
+        {
+            lp->x[i] = (fixed && fixed[i] == 1) || state[i] == LP_AT_UPPER ? 1.0 : 0.0;
+        }
+        for (int k = 0; k < m; k++)
+        {
+            if (basis[k] < n)
+            {
+                double v = values[k];
+                lp->x[basis[k]] = v < 0 ? 0 : (v > 1 ? 1 : v);
+            }
+            lp->duals[k] = -reduced[n + k] > 0 ? -reduced[n + k] : 0.0;
+        }
+        lp->bound = 0.0;
+        for (int i = 0; i < n; i++)
+        {
+            if (!(fixed && fixed[i] == 1))
+            {
+                lp->bound += instance->profits[i] * lp->x[i];
+            }
+            double cost = instance->profits[i];
+            for (int k = 0; k < m; k++)
+            {
+                cost -= lp->duals[k] * instance->weights[k][i];
+            }
+            lp->reduced_costs[i] = cost;
+        }
+        lp->bound += fixed_profit;
+    }
+
+    free(tableau);
+    free(values);
+    free(reduced);
+    free(upper);
+    free(basis);
+    free(state);
+    return lp->status == LP_OPTIMAL ? 0 : -1;
+}
+
+void lp_free(LpRelaxation *lp)
+{
+    free(lp->x);
+    free(lp->duals);
+    free(lp->reduced_costs);
+    lp->x = NULL;
+    lp->duals = NULL;
+    lp->reduced_costs = NULL;
+}
+
+double lp_upper_bound(const KnapsackInstance *instance)
+{
+    LpRelaxation lp;
+    double bound = lp_solve(instance, NULL, &lp) == 0 ? lp.bound : -1.0;
+    lp_free(&lp);
+    return bound;
+}
+
+int *dual_utility_order(const KnapsackInstance *instance, const double *duals)
+{
+    int *order = (int *)malloc(instance->n * sizeof(int));
+    double *utilities = (double *)malloc(instance->n * sizeof(double));
+    if (!order || !utilities)
+    {
+        perror("Erreur d'allocation mémoire (dual_utility_order)");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < instance->n; i++)
+    {
+        double weight = 0.0;
+        for (int k = 0; k < instance->m; k++)
+        {
+            weight += duals[k] * instance->weights[k][i];
+        }
+        // Un objet qui ne pèse sur aucune contrainte tendue passe en tête
+        utilities[i] = weight > LP_EPSILON ? instance->profits[i] / weight : HUGE_VAL;
+        order[i] = i;
+    }
+    sort_utilities = utilities;
+    qsort(order, instance->n, sizeof(int), compare_utilities);
+    free(utilities);
+    return order;
+}
+
+int *lp_utility_order(const KnapsackInstance *instance)
+{
+    LpRelaxation lp;
+    int *order = lp_solve(instance, NULL, &lp) == 0 ? dual_utility_order(instance, lp.duals) : efficiency_order(instance);
+    lp_free(&lp);
+    return order;
+}
+
+KnapsackSolution *greedy_dual_solution(const KnapsackInstance *instance)
+{
+    // Depuis le sac vide, la réparation se réduit à l'ajout glouton suivant l'ordre
+    KnapsackSolution *solution = init_solution(instance->n);
+    int *order = lp_utility_order(instance);
+    repair_solution(solution, instance, order);
+    free(order);
+    return solution;
+}
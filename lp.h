@@ -0,0 +1,85 @@
+#ifndef LP_H
+#define LP_H
+
+#include "heuristique.h"
+
+/**
+ * @brief Issue de la résolution d'une relaxation linéaire.
+ */
+typedef enum {
+    LP_OPTIMAL,    ///< Optimum atteint.
+    LP_INFEASIBLE, ///< Les variables fixées à 1 dépassent déjà une capacité.
+    LP_ITERATION_LIMIT ///< Limite d'itérations atteinte (la borne n'est pas garantie).
+} LpStatus;
+
+/**
+ * @brief Relaxation linéaire du MKP : max p.x sous W.x <= c et 0 <= x <= 1.
+ */
+typedef struct {
+    LpStatus status;        ///< Issue de la résolution.
+    double bound;           ///< Valeur optimale de la relaxation (borne supérieure du MKP).
+    double *x;              ///< Solution primale (n valeurs dans [0, 1]).
+    double *duals;          ///< Variables duales des contraintes (m valeurs positives).
+    double *reduced_costs;  ///< Coûts réduits p[i] - duals.W[.][i] (n valeurs).
+    int iterations;         ///< Nombre d'itérations du simplexe.
+} LpRelaxation;
+
+/**
+ * @brief Résout la relaxation linéaire par un simplexe primal dense à variables bornées.
+ *
+ * Les bornes 0 <= x <= 1 sont traitées implicitement (une variable hors base est à sa
+ * borne inférieure ou supérieure, et peut passer de l'une à l'autre sans pivot) : seules
+ * les m contraintes de capacité forment la base, dont les variables d'écart donnent une
+ * base initiale réalisable. Chaque itération coûte O(m × (n + m)).
+ *
+ * @param instance Instance du problème.
+ * @param fixed Valeur imposée de chaque objet (-1 : libre, 0 ou 1 : fixé), ou `NULL` si tous sont libres.
+ * @param lp Résultat, alloué par la fonction (à libérer avec `lp_free`, même en cas d'échec).
+ * @return 0 si la relaxation est résolue à l'optimum, -1 sinon (voir `lp->status`).
+ */
+int lp_solve(const KnapsackInstance *instance, const int *fixed, LpRelaxation *lp);
+
+/**
+ * @brief Libère les tableaux d'une relaxation linéaire.
+ *
+ * @param lp Relaxation à libérer.
+ */
+void lp_free(LpRelaxation *lp);
+
+/**
+ * @brief Calcule seulement la borne de la relaxation linéaire.
+ *
+ * @param instance Instance du problème.
+ * @return La borne supérieure, ou -1 si la relaxation n'a pas pu être résolue.
+ */
+double lp_upper_bound(const KnapsackInstance *instance);
+
+/**
+ * @brief Ordonne les objets par pseudo-utilité p[i] / (duals.W[.][i]) décroissante.
+ *
+ * Les variables duales pondèrent les contraintes selon leur tension : c'est l'ordre de
+ * l'opérateur de réparation de Chu et Beasley, utilisable avec `repair_solution`.
+ *
+ * @param instance Instance du problème.
+ * @param duals Variables duales (m valeurs), par exemple `LpRelaxation.duals`.
+ * @return Un tableau de `n` indices, à libérer avec `free`.
+ */
+int *dual_utility_order(const KnapsackInstance *instance, const double *duals);
+
+/**
+ * @brief Résout la relaxation et retourne l'ordre des pseudo-utilités (ou l'ordre d'efficacité si elle échoue).
+ *
+ * @param instance Instance du problème.
+ * @return Un tableau de `n` indices, à libérer avec `free`.
+ */
+int *lp_utility_order(const KnapsackInstance *instance);
+
+/**
+ * @brief Solution gloutonne suivant les pseudo-utilités duales.
+ *
+ * @param instance Instance du problème.
+ * @return Une solution faisable et évaluée (à libérer avec `free_solution`).
+ */
+KnapsackSolution *greedy_dual_solution(const KnapsackInstance *instance);
+
+#endif // LP_H
@@ -1,10 +1,45 @@
 #include "genetic.h"
+#include "portfolio.h"
+#include "brkga.h"
+#include "path_relinking.h"
+#include "eda.h"
+#include "aco.h"
+#include "lp.h"
+#include "surrogate.h"
+#include "lagrangian.h"
+#include "bnb.h"
+#include "core.h"
+#include "presolve.h"
+#include "dp.h"
+#include "kernel.h"
+#include "alns.h"
+#include <string.h>
 
 int main(int argc, char *argv[])
 {
     if (argc < 3)
     {
-        printf("Usage: %s <fichier_instance> <temps_max>\n", argv[0]);
+        printf("Usage: %s <fichier_instance> <temps_max> [-P] [-d] [-R] [-L] [-E] [-U] [-A] [-l] [-X] [-N] [-g] [-H] [options du génétique] [-a] [--alns-stats fichier] [-K taille] [-p] [-t threads] [-s graine] [-S threads] [-n objets] [-B] [-c entrées] [--target valeur] [--optimal] [-G]\n", argv[0]);
+        printf("-P : mode portefeuille (VNS gloutonne, VNS aléatoire, génétique et hybride en parallèle)\n");
+        printf("-d : portefeuille déterministe (résultat identique quel que soit le nombre de threads)\n");
+        printf("-R : BRKGA (génétique à clés aléatoires biaisées, décodage sur -t threads)\n");
+        printf("-L : archive d'élites alimentée par VNS puis path relinking\n");
+        printf("-E : PBIL, -U : UMDA (estimation de distribution, tirage et réparation sur -t threads)\n");
+        printf("-A : colonie de fourmis MAX-MIN (fourmis construites sur -t threads)\n");
+        printf("-l : relaxation lagrangienne (sous-gradient, réparation des sous-problèmes)\n");
+        printf("-X : séparation et évaluation exacte (sous-arbres répartis sur -t threads), borne et écart si la limite de temps l'interrompt\n");
+        printf("-N : recherche par noyau (noyau et paquet de variables libérés, résolus exactement ; paquets d'un tour sur -t threads)\n");
+        printf("-g : algorithme génétique, -H : hybride GA + VNS (paramètres du portefeuille, options ci-dessous)\n");
+        print_genetic_options_usage();
+        printf("-a : recherche adaptative à grand voisinage (ALNS), statistiques des opérateurs affichées ; --alns-stats : export CSV de ces statistiques\n");
+        printf("-K : méthode choisie appliquée au problème cœur (taille : nombre maximal d'objets libres, 0 : seulement la fixation sûre par coûts réduits)\n");
+        printf("Les instances à une ou deux contraintes de capacités modérées sont résolues exactement par programmation dynamique\n");
+        printf("-p : prétraitement (retrait des objets qui ne tiennent jamais et des contraintes redondantes)\n");
+        printf("-t : nombre de threads du portefeuille déterministe, -s : graine\n");
+        printf("-S : threads du voisinage swap parallèle, -n : nombre d'objets à partir duquel il s'applique, -B : meilleur améliorant\n");
+        printf("-c : taille du cache des optima de VND (0 pour le désactiver)\n");
+        printf("-G : glouton et réparation ordonnés par les multiplicateurs surrogate\n");
+        printf("--target : arrêt dès qu'une solution atteint la valeur, --optimal : arrêt dès qu'une solution atteint la borne LP (optimalité prouvée)\n");
         return 1;
     }
     srand(time(NULL));
@@ -14,6 +49,158 @@ int main(int argc, char *argv[])
 
     int temps_max = atoi(argv[2]);
 
+    int portfolio_mode = 0;
+    int brkga_mode = 0;
+    int relinking_mode = 0;
+    int eda_mode = 0;
+    EdaVariant eda_variant = EDA_PBIL;
+    int aco_mode = 0;
+    int lagrangian_mode = 0;
+    int bnb_mode = 0;
+    int kernel_mode = 0;
+    int alns_mode = 0;
+    int surrogate_key = 0;
+    int genetic_mode = 0;
+    int hybrid_mode = 0;
+    GeneticConfig genetic_options = default_genetic_config();
+    const char *alns_stats_file = NULL;
+    int core_size = -1;
+    int presolve_mode = 0;
+    int swap_threads = 0;
+    int swap_min_items = 1000;
+    int swap_best = 0;
+    int target = 0;
+    int stop_at_optimal = 0;
+    PortfolioConfig config = default_portfolio_config();
+    config.seed = (unsigned long long)time(NULL);
+    for (int i = 3; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-P") == 0)
+        {
+            portfolio_mode = 1;
+        }
+        else if (strcmp(argv[i], "-d") == 0)
+        {
+            portfolio_mode = 1;
+            config.deterministic = 1;
+        }
+        else if (strcmp(argv[i], "-R") == 0)
+        {
+            brkga_mode = 1;
+        }
+        else if (strcmp(argv[i], "-L") == 0)
+        {
+            relinking_mode = 1;
+        }
+        else if (strcmp(argv[i], "-E") == 0 || strcmp(argv[i], "-U") == 0)
+        {
+            eda_mode = 1;
+            eda_variant = argv[i][1] == 'U' ? EDA_UMDA : EDA_PBIL;
+        }
+        else if (strcmp(argv[i], "-A") == 0)
+        {
+            aco_mode = 1;
+        }
+        else if (strcmp(argv[i], "-l") == 0)
+        {
+            lagrangian_mode = 1;
+        }
+        else if (strcmp(argv[i], "-X") == 0)
+        {
+            bnb_mode = 1;
+        }
+        else if (strcmp(argv[i], "-N") == 0)
+        {
+            kernel_mode = 1;
+        }
+        else if (strcmp(argv[i], "-g") == 0)
+        {
+            genetic_mode = 1;
+        }
+        else if (strcmp(argv[i], "-H") == 0)
+        {
+            hybrid_mode = 1;
+        }
+        else if (parse_genetic_option(argc, argv, &i, &genetic_options))
+        {
+            // Option du génétique, reprise par genetic_algorithm et hybrid_GA_VNS
+        }
+        else if (strcmp(argv[i], "-a") == 0)
+        {
+            alns_mode = 1;
+        }
+        else if (strcmp(argv[i], "--alns-stats") == 0 && i + 1 < argc)
+        {
+            alns_mode = 1;
+            alns_stats_file = argv[++i];
+        }
+        else if (strcmp(argv[i], "-K") == 0 && i + 1 < argc)
+        {
+            core_size = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-p") == 0)
+        {
+            presolve_mode = 1;
+        }
+        else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+        {
+            config.thread_count = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+        {
+            config.seed = strtoull(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "-S") == 0 && i + 1 < argc)
+        {
+            swap_threads = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+        {
+            swap_min_items = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-B") == 0)
+        {
+            swap_best = 1;
+        }
+        else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+        {
+            configure_vnd_cache(atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--target") == 0 && i + 1 < argc)
+        {
+            target = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--optimal") == 0)
+        {
+            stop_at_optimal = 1;
+        }
+        else if (strcmp(argv[i], "-G") == 0)
+        {
+            surrogate_key = 1;
+        }
+    }
+
+    configure_genetic_options(&genetic_options);
+
+    // Critère d'arrêt : la plus petite des cibles fixées (valeur demandée, optimalité prouvée)
+    if (stop_at_optimal)
+    {
+        int proven = proven_optimality_target(&ksInstance);
+        if (proven > 0 && (target <= 0 || proven < target))
+        {
+            target = proven;
+        }
+    }
+    config.target = target;
+
+    // Voisinage swap évalué en parallèle sur les grandes instances
+    ThreadPool *swap_pool = NULL;
+    if (swap_threads > 0)
+    {
+        swap_pool = thread_pool_create(swap_threads);
+        configure_parallel_swap(swap_pool, swap_min_items, swap_best);
+    }
+
     // KnapsackSolution *ksSolution = random_initial_solution(&ksInstance);
     // KnapsackSolution *ksSolution = greedy_initial_solution(&ksInstance);
 
@@ -35,23 +222,271 @@ int main(int argc, char *argv[])
     variable_neighborhood_descent(ksSolution, &ksInstance, temps_max); 
     */
     
-    // Appliquer la recherche à voisinage variable (VNS)
-    KnapsackSolution *ksSolution = random_initial_solution(&ksInstance);
-    printf("Avant VNS descent : Z = %d\n", ksSolution->Z);
-    variable_neighborhood_search(ksSolution, &ksInstance, 3555555, 4, temps_max);
+    KnapsackSolution *ksSolution;
+    KnapsackInstance *instance = &ksInstance;
+
+    // Prétraitement : objets qui ne tiennent jamais et contraintes redondantes retirés
+    PresolvedInstance presolved;
+    if (presolve_mode)
+    {
+        presolve_instance(&ksInstance, &presolved);
+        instance = &presolved.reduced;
+        printf("Prétraitement : %d objets sur %d, %d contraintes sur %d (%d lâches, %d dominées)\n", instance->n, ksInstance.n, instance->m, ksInstance.m, presolved.removed_loose, presolved.removed_dominated);
+    }
+    KnapsackInstance *model = instance;
+
+    // Clé d'efficacité surrogate, calculée sur le modèle prétraité (mêmes contraintes que le cœur), avant le lancement des threads
+    if (surrogate_key)
+    {
+        SurrogateRelaxation sr;
+        if (surrogate_solve(model, 30, &sr) == 0)
+        {
+            configure_efficiency_weights(sr.multipliers, model->m);
+            printf("Borne surrogate : %d\n", sr.bound);
+        }
+        surrogate_free(&sr);
+    }
+
+    // Problème cœur : objets fixés par coûts réduits (et hors cœur), à partir du glouton dual amélioré par VND
+    KnapsackSolution *incumbent = NULL;
+    ReducedProblem reduced;
+    if (core_size >= 0)
+    {
+        incumbent = greedy_dual_solution(model);
+        variable_neighborhood_descent(incumbent, model, 0);
+        if (reduce_problem(model, incumbent->Z, core_size, &reduced) == 0)
+        {
+            instance = &reduced.core;
+            printf("Problème cœur : %d objets sur %d (%d fixés par coûts réduits, %d hors cœur)\n", reduced.core.n, model->n, reduced.fixed_by_cost, reduced.fixed_by_core);
+            // Les valeurs du cœur n'incluent pas les profits des objets fixés à 1
+            if (target > 0)
+            {
+                config.target = target - reduced.fixed_profit > 0 ? target - reduced.fixed_profit : 1;
+            }
+        }
+    }
+    termination_set_target(config.target);
+    TimeValue solve_start = get_current_time();
+    double target_time = -1.0;
+
+    // Une ou deux contraintes : programmation dynamique exacte si la table tient dans la mémoire accordée
+    KnapsackSolution *dp_solution = NULL;
+    if (instance->n > 0 && instance->m <= 2)
+    {
+        size_t dp_memory = dp_memory_estimate(instance);
+        dp_solution = dp_solve(instance, DP_MEMORY_LIMIT);
+        if (dp_solution != NULL)
+        {
+            printf("Programmation dynamique : optimum exact (table de %.1f Mo)\n", dp_memory / 1048576.0);
+        }
+        else
+        {
+            printf("Programmation dynamique écartée (%.1f Mo nécessaires, %.1f Mo accordés) : méthode heuristique\n", dp_memory / 1048576.0, DP_MEMORY_LIMIT / 1048576.0);
+        }
+    }
+
+    if (instance->n == 0)
+    {
+        // Tous les objets sont fixés
+        ksSolution = init_solution(0);
+    }
+    else if (dp_solution != NULL)
+    {
+        ksSolution = dp_solution;
+    }
+    else if (portfolio_mode && (temps_max > 0 || config.deterministic))
+    {
+        // Les quatre algorithmes courent en parallèle jusqu'à la même échéance
+        PortfolioResult result = portfolio_search(instance, &config, temps_max);
+        print_portfolio_result(&result);
+        ksSolution = result.best;
+        if (ksSolution == NULL)
+        {
+            // Aucun algorithme n'a pu être lancé : solution gloutonne
+            fprintf(stderr, "Portefeuille sans résultat : solution gloutonne\n");
+            ksSolution = greedy_initial_solution(instance);
+        }
+        target_time = result.target_reached ? result.time_to_best : -1.0;
+    }
+    else if (brkga_mode)
+    {
+        // Décodage de la population réparti sur le pool
+        BrkgaConfig brkga = default_brkga_config();
+        brkga.seed = config.seed;
+        brkga.generations = 1000000;
+        brkga.pool = config.thread_count > 1 ? thread_pool_create(config.thread_count) : NULL;
+        ksSolution = brkga_search(instance, &brkga, temps_max);
+        thread_pool_destroy(brkga.pool);
+    }
+    else if (relinking_mode && temps_max > 0)
+    {
+        // Archive de 10 élites, VNS de remplissage de 200 itérations
+        ksSolution = path_relinking_search(instance, 10, 200, 2, temps_max);
+    }
+    else if ((genetic_mode || hybrid_mode) && temps_max > 0)
+    {
+        // Générations jusqu'à l'échéance, avec les options du génétique
+        if (hybrid_mode)
+        {
+            ksSolution = hybrid_GA_VNS(instance, config.hybrid_population, 1000000, config.mutation_rate, config.vns_iterations, config.hybrid_k, temps_max);
+        }
+        else
+        {
+            ksSolution = genetic_algorithm(instance, config.population_size, 1000000, config.mutation_rate, temps_max);
+        }
+    }
+    else if (eda_mode)
+    {
+        // Lot tiré et réparé sur le pool
+        EdaConfig eda = default_eda_config();
+        eda.variant = eda_variant;
+        eda.seed = config.seed;
+        eda.pool = config.thread_count > 1 ? thread_pool_create(config.thread_count) : NULL;
+        ksSolution = eda_search(instance, &eda, temps_max);
+        thread_pool_destroy(eda.pool);
+    }
+    else if (aco_mode)
+    {
+        // Fourmis construites sur le pool, phéromone mise à jour entre deux itérations
+        AcoConfig aco = default_aco_config();
+        aco.seed = config.seed;
+        aco.pool = config.thread_count > 1 ? thread_pool_create(config.thread_count) : NULL;
+        ksSolution = aco_search(instance, &aco, temps_max);
+        thread_pool_destroy(aco.pool);
+    }
+    else if (lagrangian_mode)
+    {
+        // Sous-gradient jusqu'à convergence de theta ou à l'échéance
+        LagrangianResult lagrangian;
+        lagrangian_solve(instance, 1000000, 20, temps_max, &lagrangian);
+        printf("Borne lagrangienne : %.2f (%d itérations)\n", lagrangian.bound, lagrangian.iterations);
+        ksSolution = lagrangian.best;
+        lagrangian.best = NULL;
+        lagrangian_free(&lagrangian);
+    }
+    else if (bnb_mode)
+    {
+        // Arbre exploré jusqu'à l'optimum prouvé ou à l'échéance
+        BnbConfig bnb = default_bnb_config();
+        bnb.time_limit = temps_max;
+        bnb.pool = config.thread_count > 1 ? thread_pool_create(config.thread_count) : NULL;
+        BnbResult exact;
+        bnb_solve(instance, &bnb, &exact);
+        thread_pool_destroy(bnb.pool);
+        // Sur le cœur, les valeurs sont reportées à l'instance complète
+        int offset = instance != model ? reduced.fixed_profit : 0;
+        const char *scope = instance != model && reduced.fixed_by_core > 0 ? " du cœur" : "";
+        if (exact.optimal)
+        {
+            printf("Optimum%s prouvé : %d (%ld nœuds)\n", scope, exact.best->Z + offset, exact.nodes);
+        }
+        else
+        {
+            printf("Arrêt avant la preuve : borne%s %d, écart %.4f %% (%ld nœuds)\n", scope, exact.bound + offset, 100.0 * (exact.bound - exact.best->Z) / (exact.bound + offset), exact.nodes);
+        }
+        ksSolution = exact.best;
+        exact.best = NULL;
+        bnb_free(&exact);
+    }
+    else if (kernel_mode)
+    {
+        // Paquets d'un tour résolus sur le pool, meilleure amélioration retenue entre deux tours
+        KernelConfig kernel = default_kernel_config();
+        kernel.seed = config.seed;
+        kernel.pool = config.thread_count > 1 ? thread_pool_create(config.thread_count) : NULL;
+        ksSolution = kernel_search(instance, &kernel, temps_max);
+        thread_pool_destroy(kernel.pool);
+    }
+    else if (alns_mode)
+    {
+        AlnsConfig alns = default_alns_config();
+        alns.seed = config.seed;
+        AlnsResult result;
+        alns_search(instance, &alns, temps_max, &result);
+        alns_print_stats(&result);
+        if (alns_stats_file != NULL)
+        {
+            alns_export_stats(&result, alns_stats_file);
+        }
+        ksSolution = result.best;
+        result.best = NULL;
+        alns_free(&result);
+    }
+    else
+    {
+        // Appliquer la recherche à voisinage variable (VNS)
+        ksSolution = random_initial_solution(instance);
+        printf("Avant VNS descent : Z = %d\n", ksSolution->Z);
+        variable_neighborhood_search(ksSolution, instance, 3555555, 4, temps_max);
+
+        VndCacheStats stats = vnd_cache_stats();
+        if (stats.hits + stats.misses > 0)
+        {
+            printf("Cache de VND : %ld succès, %ld échecs (%.1f %%), %ld évictions\n", stats.hits, stats.misses, 100.0 * stats.hits / (stats.hits + stats.misses), stats.evictions);
+        }
+    }
 
     
-    // KnapsackSolution *ksSolution = genetic_algorithm(&ksInstance, 5000, 5000, 0.05, temps_max); // population, generations, mutation_rate, temps_max
-    // KnapsackSolution *ksSolution = hybrid_GA_VNS(&ksInstance, 100, 100, 0.05, 100, 2,temps_max); // population, generations, mutation_rate, vns_iteration, k, temps_max
+    // KnapsackSolution *ksSolution = genetic_algorithm(instance, 5000, 5000, 0.05, temps_max); // population, generations, mutation_rate, temps_max
+    // KnapsackSolution *ksSolution = hybrid_GA_VNS(instance, 100, 100, 0.05, 100, 2,temps_max); // population, generations, mutation_rate, vns_iteration, k, temps_max
 
+    // Retour au modèle d'origine ; la solution de départ est gardée si elle reste meilleure
+    if (instance != model)
+    {
+        KnapsackSolution *full = expand_solution(&reduced, ksSolution);
+        free_solution(ksSolution);
+        ksSolution = full;
+        reduced_problem_free(&reduced);
+    }
+    if (incumbent != NULL)
+    {
+        if (incumbent->Z > ksSolution->Z)
+        {
+            copy_solution_into(ksSolution, incumbent, model->n);
+        }
+        free_solution(incumbent);
+    }
+    if (model != &ksInstance)
+    {
+        KnapsackSolution *original = postsolve_solution(&presolved, ksSolution);
+        free_solution(ksSolution);
+        ksSolution = original;
+        presolve_free(&presolved);
+    }
 
     print_solution(ksSolution, &ksInstance);
     print_solution_index(ksSolution, ksInstance.n);
 
+    // Écart à la borne de la relaxation linéaire (majore l'écart à l'optimum)
+    double lp_bound = lp_upper_bound(&ksInstance);
+    if (lp_bound > 0)
+    {
+        printf("Borne LP : %.2f, écart : %.4f %%\n", lp_bound, 100.0 * (lp_bound - ksSolution->Z) / lp_bound);
+    }
+    if (target > 0)
+    {
+        if (!portfolio_mode)
+        {
+            target_time = time_to_target();
+        }
+        if (ksSolution->Z >= target)
+        {
+            // La programmation dynamique n'enregistre pas de temps d'atteinte : durée de la résolution
+            printf("Cible %d atteinte en %.3f s\n", target, target_time >= 0 ? target_time : get_elapsed_time(solve_start, get_current_time()));
+        }
+        else
+        {
+            printf("Cible %d non atteinte\n", target);
+        }
+    }
+
     save_solution_to_file(ksSolution, &ksInstance, "solution.txt");
     // Libére la mémoire
     free_solution(ksSolution);
     free_knapsack_instance(&ksInstance);
+    configure_parallel_swap(NULL, swap_min_items, swap_best);
+    configure_efficiency_weights(NULL, 0);
+    thread_pool_destroy(swap_pool);
 
     return EXIT_SUCCESS;
 }
\ No newline at end of file
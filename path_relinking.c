@@ -0,0 +1,410 @@
+#include "path_relinking.h"
+#include <string.h>
+
+// Convertit une solution en mots de 64 bits
+static void to_bits(const int *x, int n, unsigned long long *bits, int words)
+{
+    memset(bits, 0, words * sizeof(unsigned long long));
+    for (int i = 0; i < n; i++)
+    {
+        if (x[i])
+        {
+            bits[i >> 6] |= 1ULL << (i & 63);
+        }
+    }
+}
+
+static int hamming(const unsigned long long *a, const unsigned long long *b, int words)
+{
+    int distance = 0;
+    for (int w = 0; w < words; w++)
+    {
+        distance += __builtin_popcountll(a[w] ^ b[w]);
+    }
+    return distance;
+}
+
+EliteArchive *elite_archive_create(int capacity, int n, int min_distance)
+{
+    EliteArchive *archive = (EliteArchive *)calloc(1, sizeof(EliteArchive));
+    if (!archive)
+    {
+        perror("Erreur d'allocation mémoire pour l'archive (elite_archive_create)");
+        return NULL;
+    }
+    pthread_mutex_init(&archive->lock, NULL);
+    archive->capacity = capacity;
+    archive->n = n;
+    archive->words = (n + 63) / 64;
+    archive->min_distance = min_distance;
+    archive->solutions = (KnapsackSolution **)calloc(capacity, sizeof(KnapsackSolution *));
+    archive->bits = (unsigned long long *)calloc((size_t)capacity * archive->words, sizeof(unsigned long long));
+    if (!archive->solutions || !archive->bits)
+    {
+        perror("Erreur d'allocation mémoire pour l'archive (elite_archive_create)");
+        elite_archive_free(archive);
+        return NULL;
+    }
+    for (int j = 0; j < capacity; j++)
+    {
+        archive->solutions[j] = init_solution(n);
+    }
+    return archive;
+}
+
+int elite_archive_insert(EliteArchive *archive, const KnapsackSolution *solution)
+{
+    unsigned long long *bits = (unsigned long long *)malloc(archive->words * sizeof(unsigned long long));
+    if (!bits)
+    {
+        perror("Erreur d'allocation mémoire (elite_archive_insert)");
+        return 0;
+    }
+    to_bits(solution->x, archive->n, bits, archive->words);
+
+    pthread_mutex_lock(&archive->lock);
+    int best_Z = 0;
+    int min_distance = archive->n + 1;
+    int slot = -1;
+    int closest_worse = archive->n + 1;
+    int duplicate = 0;
+    for (int j = 0; j < archive->count && !duplicate; j++)
+    {
+        int d = hamming(bits, &archive->bits[(size_t)j * archive->words], archive->words);
+        duplicate = (d == 0);
+        if (d < min_distance)
+        {
+            min_distance = d;
+        }
+        if (archive->solutions[j]->Z > best_Z)
+        {
+            best_Z = archive->solutions[j]->Z;
+        }
+        // Candidat au remplacement : le membre moins bon le plus proche
+        if (archive->solutions[j]->Z < solution->Z && d < closest_worse)
+        {
+            closest_worse = d;
+            slot = j;
+        }
+    }
+
+    int accepted = 0;
+    int new_best = archive->count == 0 || solution->Z > best_Z;
+    if (!duplicate && (new_best || min_distance >= archive->min_distance))
+    {
+        if (archive->count < archive->capacity)
+        {
+            slot = archive->count++;
+        }
+        if (slot >= 0)
+        {
+            copy_solution_into(archive->solutions[slot], solution, archive->n);
+            memcpy(&archive->bits[(size_t)slot * archive->words], bits, archive->words * sizeof(unsigned long long));
+            accepted = 1;
+        }
+    }
+    pthread_mutex_unlock(&archive->lock);
+
+    free(bits);
+    return accepted;
+}
+
+KnapsackSolution *elite_archive_best(EliteArchive *archive)
+{
+    KnapsackSolution *best = NULL;
+    pthread_mutex_lock(&archive->lock);
+    int best_index = -1;
+    for (int j = 0; j < archive->count; j++)
+    {
+        if (best_index < 0 || archive->solutions[j]->Z > archive->solutions[best_index]->Z)
+        {
+            best_index = j;
+        }
+    }
+    if (best_index >= 0)
+    {
+        best = init_solution(archive->n);
+        copy_solution_into(best, archive->solutions[best_index], archive->n);
+    }
+    pthread_mutex_unlock(&archive->lock);
+    return best;
+}
+
+void elite_archive_free(EliteArchive *archive)
+{
+    if (archive == NULL)
+    {
+        return;
+    }
+    if (archive->solutions)
+    {
+        for (int j = 0; j < archive->capacity; j++)
+        {
+            if (archive->solutions[j])
+            {
+                free_solution(archive->solutions[j]);
+            }
+        }
+    }
+    pthread_mutex_destroy(&archive->lock);
+    free(archive->solutions);
+    free(archive->bits);
+    free(archive);
+}
+
+KnapsackSolution *path_relinking(const KnapsackInstance *instance, const KnapsackSolution *from, const KnapsackSolution *to, int ls_points)
+{
+    int n = instance->n;
+    int m = instance->m;
+    if (ls_points < 1)
+    {
+        ls_points = 1;
+    }
+
+    // Objets où les deux solutions diffèrent
+    int *diff = (int *)malloc(n * sizeof(int));
+    int *load = (int *)calloc(m, sizeof(int));
+    if (!diff || !load)
+    {
+        perror("Erreur d'allocation mémoire (path_relinking)");
+        exit(EXIT_FAILURE);
+    }
+    int remaining = 0;
+    for (int i = 0; i < n; i++)
+    {
+        if (from->x[i] != to->x[i])
+        {
+            diff[remaining++] = i;
+        }
+    }
+    if (remaining < 2)
+    {
+        free(diff);
+        free(load);
+        return NULL;
+    }
+
+    KnapsackSolution *current = init_solution(n);
+    copy_solution_into(current, from, n);
+    evaluate_solution(current, instance);
+    for (int k = 0; k < m; k++)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            if (current->x[i])
+            {
+                load[k] += instance->weights[k][i];
+            }
+        }
+    }
+
+    // Meilleurs points intermédiaires rencontrés
+    KnapsackSolution **points = (KnapsackSolution **)malloc(ls_points * sizeof(KnapsackSolution *));
+    if (!points)
+    {
+        perror("Erreur d'allocation mémoire (path_relinking)");
+        exit(EXIT_FAILURE);
+    }
+    int kept = 0;
+
+    // Le dernier pas mènerait à `to` : il n'est pas parcouru
+    while (remaining > 1)
+    {
+        int best_r = -1;
+        int best_delta = 0;
+        for (int r = 0; r < remaining; r++)
+        {
+            int i = diff[r];
+            int delta;
+            if (current->x[i])
+            {
+                delta = -instance->profits[i];
+            }
+            else
+            {
+                int fits = 1;
+                for (int k = 0; k < m && fits; k++)
+                {
+                    fits = load[k] + instance->weights[k][i] <= instance->capacities[k];
+                }
+                if (!fits)
+                {
+                    continue;
+                }
+                delta = instance->profits[i];
+            }
+            if (best_r < 0 || delta > best_delta)
+            {
+                best_r = r;
+                best_delta = delta;
+            }
+        }
+        if (best_r < 0)
+        {
+            // Impossible tant qu'un retrait reste possible ; par sécurité
+            break;
+        }
+
+        int i = diff[best_r];
+        int sign = current->x[i] ? -1 : 1;
+        current->x[i] = 1 - current->x[i];
+        current->Z += best_delta;
+        for (int k = 0; k < m; k++)
+        {
+            load[k] += sign * instance->weights[k][i];
+        }
+        diff[best_r] = diff[--remaining];
+
+        // Conserver le point s'il fait partie des meilleurs du chemin
+        if (kept < ls_points)
+        {
+            points[kept] = init_solution(n);
+            copy_solution_into(points[kept++], current, n);
+        }
+        else
+        {
+            int worst = 0;
+            for (int p = 1; p < kept; p++)
+            {
+                if (points[p]->Z < points[worst]->Z)
+                {
+                    worst = p;
+                }
+            }
+            if (current->Z > points[worst]->Z)
+            {
+                copy_solution_into(points[worst], current, n);
+            }
+        }
+    }
+
+    // Recherche locale sur les meilleurs points intermédiaires
+    KnapsackSolution *best = NULL;
+    for (int p = 0; p < kept; p++)
+    {
+        variable_neighborhood_descent(points[p], instance, 0);
+        if (best == NULL || points[p]->Z > best->Z)
+        {
+            best = points[p];
+        }
+    }
+    KnapsackSolution *result = NULL;
+    if (best != NULL)
+    {
+        result = init_solution(n);
+        copy_solution_into(result, best, n);
+    }
+
+    for (int p = 0; p < kept; p++)
+    {
+        free_solution(points[p]);
+    }
+    free(points);
+    free_solution(current);
+    free(diff);
+    free(load);
+    return result;
+}
+
+// Copie un membre de l'archive sous verrou (les membres peuvent être remplacés entre-temps)
+static KnapsackSolution *archive_member(EliteArchive *archive, int j)
+{
+    KnapsackSolution *copy = NULL;
+    pthread_mutex_lock(&archive->lock);
+    if (j < archive->count)
+    {
+        copy = init_solution(archive->n);
+        copy_solution_into(copy, archive->solutions[j], archive->n);
+    }
+    pthread_mutex_unlock(&archive->lock);
+    return copy;
+}
+
+// Relie deux membres, du meilleur vers le moins bon, et propose le résultat à l'archive ; retourne sa valeur (0 sans résultat)
+static int relink_pair(const KnapsackInstance *instance, EliteArchive *archive, int a, int b, int ls_points)
+{
+    int value = 0;
+    KnapsackSolution *first = archive_member(archive, a);
+    KnapsackSolution *second = archive_member(archive, b);
+    if (first && second)
+    {
+        int first_better = first->Z >= second->Z;
+        KnapsackSolution *result = path_relinking(instance, first_better ? first : second, first_better ? second : first, ls_points);
+        if (result)
+        {
+            value = result->Z;
+            elite_archive_insert(archive, result);
+            free_solution(result);
+        }
+    }
+    if (first) free_solution(first);
+    if (second) free_solution(second);
+    return value;
+}
+
+int relink_archive(const KnapsackInstance *instance, EliteArchive *archive, int ls_points, TimeValue start_time, double time_limit)
+{
+    pthread_mutex_lock(&archive->lock);
+    int count = archive->count;
+    pthread_mutex_unlock(&archive->lock);
+
+    int paths = 0;
+    for (int a = 0; a < count; a++)
+    {
+        for (int b = a + 1; b < count; b++)
+        {
+            if (time_exceeded(start_time, time_limit))
+            {
+                return paths;
+            }
+            int value = relink_pair(instance, archive, a, b, ls_points);
+            paths++;
+            if (target_reached(value))
+            {
+                return paths;
+            }
+        }
+    }
+    return paths;
+}
+
+KnapsackSolution *path_relinking_search(const KnapsackInstance *instance, int archive_size, int vns_iterations, int k_perturbation, double time_limit)
+{
+    TimeValue start = get_current_time();
+    int min_distance = instance->n / 50 > 2 ? instance->n / 50 : 2;
+    EliteArchive *archive = elite_archive_create(archive_size, instance->n, min_distance);
+    if (!archive)
+    {
+        return NULL;
+    }
+
+    int best_Z = 0;
+    while (!time_exceeded(start, time_limit) && !target_reached(best_Z))
+    {
+        int count = archive->count;
+        if (count < 2 || !time_exceeded(start, time_limit / 2))
+        {
+            // Remplissage : VNS depuis une solution aléatoire
+            KnapsackSolution *solution = random_initial_solution(instance);
+            variable_neighborhood_search_budget(solution, instance, vns_iterations, k_perturbation, start, time_limit);
+            best_Z = solution->Z > best_Z ? solution->Z : best_Z;
+            elite_archive_insert(archive, solution);
+            free_solution(solution);
+            continue;
+        }
+
+        // Relinking : une paire de membres tirée au hasard
+        int a = rng_rand() % count;
+        int b = rng_rand() % (count - 1);
+        if (b >= a)
+        {
+            b++;
+        }
+        int value = relink_pair(instance, archive, a, b, 3);
+        best_Z = value > best_Z ? value : best_Z;
+    }
+
+    KnapsackSolution *best = elite_archive_best(archive);
+    elite_archive_free(archive);
+    return best;
+}
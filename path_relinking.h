@@ -0,0 +1,113 @@
+#ifndef PATH_RELINKING_H
+#define PATH_RELINKING_H
+
+#include "heuristique.h"
+#include <pthread.h>
+
+/**
+ * @brief Archive bornée de solutions élites, de bonne qualité et deux à deux différentes.
+ *
+ * Chaque membre est aussi stocké en mots de 64 bits : la distance de Hamming entre deux
+ * solutions se calcule par `popcount` du XOR, en O(n / 64). L'archive est protégée par un
+ * verrou et peut être alimentée depuis plusieurs threads (VNS, génétique, portefeuille).
+ */
+typedef struct {
+    int capacity;                 ///< Nombre maximal de membres.
+    int count;                    ///< Nombre de membres.
+    int n;                        ///< Nombre d'objets.
+    int words;                    ///< Nombre de mots de 64 bits par membre.
+    int min_distance;             ///< Distance de Hamming minimale à tous les membres pour entrer (sauf nouveau meilleur).
+    KnapsackSolution **solutions; ///< Membres de l'archive.
+    unsigned long long *bits;     ///< Membres en mots de 64 bits (`capacity` × `words`).
+    pthread_mutex_t lock;         ///< Verrou de l'archive.
+} EliteArchive;
+
+/**
+ * @brief Crée une archive d'élites vide.
+ *
+ * @param capacity Nombre maximal de membres.
+ * @param n Nombre d'objets de l'instance.
+ * @param min_distance Distance de Hamming minimale exigée pour entrer dans l'archive.
+ * @return L'archive, ou `NULL` en cas d'erreur d'allocation.
+ */
+EliteArchive *elite_archive_create(int capacity, int n, int min_distance);
+
+/**
+ * @brief Propose une solution à l'archive.
+ *
+ * Une solution déjà présente est refusée. Une solution meilleure que tous les membres est
+ * toujours acceptée ; sinon elle doit être à distance au moins `min_distance` de chaque
+ * membre. Si l'archive est pleine, elle remplace, parmi les membres moins bons qu'elle,
+ * celui qui lui ressemble le plus ; elle est refusée s'il n'y en a aucun.
+ *
+ * @param archive Archive modifiée.
+ * @param solution Solution faisable et évaluée (copiée si elle est acceptée).
+ * @return 1 si la solution est entrée dans l'archive, 0 sinon.
+ */
+int elite_archive_insert(EliteArchive *archive, const KnapsackSolution *solution);
+
+/**
+ * @brief Copie le meilleur membre de l'archive.
+ *
+ * @param archive Archive consultée.
+ * @return Une copie du meilleur membre (à libérer avec `free_solution`), ou `NULL` si l'archive est vide.
+ */
+KnapsackSolution *elite_archive_best(EliteArchive *archive);
+
+/**
+ * @brief Libère une archive et ses membres.
+ *
+ * @param archive Archive à libérer (peut être `NULL`).
+ */
+void elite_archive_free(EliteArchive *archive);
+
+/**
+ * @brief Relie deux solutions par un chemin de solutions faisables et améliore les meilleurs points du chemin.
+ *
+ * Partant de `from`, chaque pas inverse l'un des objets où `from` et `to` diffèrent encore :
+ * celui qui donne la meilleure valeur parmi les mouvements faisables (un retrait l'est
+ * toujours, un ajout s'il tient dans les capacités restantes). Chaque mouvement candidat est
+ * évalué en O(m) grâce aux charges tenues à jour. Les `ls_points` meilleures solutions
+ * intermédiaires (hors extrémités) reçoivent ensuite une VND.
+ *
+ * @param instance Instance du problème.
+ * @param from Solution de départ (faisable).
+ * @param to Solution guide (faisable).
+ * @param ls_points Nombre de solutions intermédiaires améliorées par VND (au moins 1).
+ * @return La meilleure solution obtenue (à libérer avec `free_solution`), ou `NULL` si les
+ *         deux solutions diffèrent de moins de deux objets (pas de point intermédiaire).
+ */
+KnapsackSolution *path_relinking(const KnapsackInstance *instance, const KnapsackSolution *from, const KnapsackSolution *to, int ls_points);
+
+/**
+ * @brief Relie chaque paire de membres de l'archive (du meilleur vers le moins bon) et y propose les résultats.
+ *
+ * S'arrête dès qu'un chemin atteint la cible du thread (`termination.h`).
+ *
+ * @param instance Instance du problème.
+ * @param archive Archive utilisée et enrichie.
+ * @param ls_points Nombre de points intermédiaires améliorés par chemin.
+ * @param start_time Départ de l'échéance.
+ * @param time_limit Durée maximale en secondes à partir de `start_time` (0 pour traiter toutes les paires une fois).
+ * @return Le nombre de chemins parcourus.
+ */
+int relink_archive(const KnapsackInstance *instance, EliteArchive *archive, int ls_points, TimeValue start_time, double time_limit);
+
+/**
+ * @brief Mode autonome : archive alimentée par des VNS depuis des solutions aléatoires, puis relinking.
+ *
+ * Les VNS (`vns_iterations` itérations chacune) remplissent l'archive pendant la première
+ * moitié du temps ; le reste du temps, des paires de membres tirées au hasard sont reliées et
+ * les résultats proposés à l'archive. La recherche s'arrête dès que la cible du thread
+ * (`termination.h`) est atteinte.
+ *
+ * @param instance Instance du problème.
+ * @param archive_size Capacité de l'archive.
+ * @param vns_iterations Itérations de chaque VNS de remplissage.
+ * @param k_perturbation Intensité de la perturbation des VNS.
+ * @param time_limit Durée totale en secondes (strictement positive).
+ * @return La meilleure solution trouvée (à libérer avec `free_solution`).
+ */
+KnapsackSolution *path_relinking_search(const KnapsackInstance *instance, int archive_size, int vns_iterations, int k_perturbation, double time_limit);
+
+#endif // PATH_RELINKING_H
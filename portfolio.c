@@ -0,0 +1,319 @@
+#include "portfolio.h"
+#include <pthread.h>
+#include <string.h>
+#include <stdatomic.h>
+
+// Meilleure solution partagée entre les threads du portefeuille
+typedef struct {
+    pthread_mutex_t lock;
+    KnapsackSolution *best;      // Protégée par lock
+    const char *source;          // Protégée par lock
+    double time_to_best;         // Protégée par lock
+    atomic_int best_Z;           // Copie lisible sans verrou de best->Z
+} SharedIncumbent;
+
+typedef struct {
+    const KnapsackInstance *instance;
+    const PortfolioConfig *config;
+    SharedIncumbent *shared;
+    SolverType type;
+    KnapsackSolution *(*initialization_function)(const KnapsackInstance *);
+    unsigned long long seed;
+    TimeValue start_time;
+    double time_limit;
+    PortfolioMemberResult *result;
+} PortfolioMember;
+
+PortfolioConfig default_portfolio_config(void)
+{
+    PortfolioConfig config;
+    config.use_greedy_vns = 1;
+    config.use_random_vns = 1;
+    config.use_genetic = 1;
+    config.use_hybrid = 1;
+    config.k_perturbation = 4;
+    config.population_size = 600;
+    config.mutation_rate = 0.05;
+    config.hybrid_population = 100;
+    config.vns_iterations = 100;
+    config.hybrid_k = 2;
+    config.step_budget = 1;
+    config.seed = 0;
+    config.tasks_per_algorithm = 1;
+    config.deterministic = 0;
+    config.thread_count = 1;
+    config.epochs = 50;
+    config.epoch_budget = 20;
+    config.target = 0;
+    return config;
+}
+
+// Vrai dès que la solution partagée atteint la cible du portefeuille
+static int shared_target_reached(const PortfolioConfig *config, SharedIncumbent *shared)
+{
+    return config->target > 0 && atomic_load(&shared->best_Z) >= config->target;
+}
+
+// Publie la solution si elle améliore la solution partagée
+static void publish(PortfolioMember *member, const KnapsackSolution *solution)
+{
+    SharedIncumbent *shared = member->shared;
+    if (solution->Z <= atomic_load(&shared->best_Z))
+    {
+        return;
+    }
+    pthread_mutex_lock(&shared->lock);
+    if (solution->Z > shared->best->Z)
+    {
+        copy_solution_into(shared->best, solution, member->instance->n);
+        shared->source = member->result->name;
+        shared->time_to_best = get_elapsed_time(member->start_time, get_current_time());
+        atomic_store(&shared->best_Z, solution->Z);
+    }
+    pthread_mutex_unlock(&shared->lock);
+}
+
+// Reprend la solution partagée si elle est meilleure que celle du solveur
+static void adopt(PortfolioMember *member, KnapsackSolver *solver, KnapsackSolution *buffer)
+{
+    SharedIncumbent *shared = member->shared;
+    if (atomic_load(&shared->best_Z) <= solver_best(solver)->Z)
+    {
+        return;
+    }
+    pthread_mutex_lock(&shared->lock);
+    copy_solution_into(buffer, shared->best, member->instance->n);
+    pthread_mutex_unlock(&shared->lock);
+
+    solver_reseed(solver, buffer);
+    member->result->reseeds++;
+}
+
+static KnapsackSolver *create_member_solver(const PortfolioMember *member)
+{
+    const PortfolioConfig *config = member->config;
+    if (member->type == SOLVER_VNS)
+    {
+        return solver_create_vns(member->instance, member->initialization_function, config->k_perturbation, member->seed);
+    }
+    if (member->type == SOLVER_GENETIC)
+    {
+        return solver_create_genetic(member->instance, config->population_size, config->mutation_rate, member->seed);
+    }
+    return solver_create_hybrid(member->instance, config->hybrid_population, config->mutation_rate, config->vns_iterations, config->hybrid_k, member->seed);
+}
+
+static void *portfolio_member_run(void *arg)
+{
+    PortfolioMember *member = (PortfolioMember *)arg;
+    const PortfolioConfig *config = member->config;
+    const KnapsackInstance *instance = member->instance;
+
+    KnapsackSolver *solver = create_member_solver(member);
+    if (!solver)
+    {
+        return NULL;
+    }
+    solver_set_deadline(solver, member->start_time, member->time_limit);
+
+    KnapsackSolution *buffer = init_solution(instance->n);
+    while (!time_exceeded(member->start_time, member->time_limit) && !shared_target_reached(config, member->shared))
+    {
+        solver_step(solver, config->step_budget);
+        publish(member, solver_best(solver));
+        adopt(member, solver, buffer);
+    }
+
+    member->result->value = solver_best(solver)->Z;
+    member->result->work_done = solver->work_done;
+
+    free_solution(buffer);
+    solver_destroy(solver);
+    return NULL;
+}
+
+// Construit les tâches logiques : tasks_per_algorithm tâches par algorithme activé
+static int build_members(const KnapsackInstance *instance, const PortfolioConfig *config, SharedIncumbent *shared, TimeValue start_time, double time_limit, PortfolioMember *members, PortfolioResult *result)
+{
+    int enabled[4] = {config->use_greedy_vns, config->use_random_vns, config->use_genetic, config->use_hybrid};
+    const char *names[4] = {"VNS Gloutonne", "VNS Aléatoire", "Génétique", "Hybride GA + VNS"};
+    SolverType types[4] = {SOLVER_VNS, SOLVER_VNS, SOLVER_GENETIC, SOLVER_HYBRID};
+    KnapsackSolution *(*initializations[4])(const KnapsackInstance *) = {greedy_initial_solution, random_initial_solution, NULL, NULL};
+    int tasks_per_algorithm = config->tasks_per_algorithm > 0 ? config->tasks_per_algorithm : 1;
+
+    int count = 0;
+    for (int a = 0; a < 4; a++)
+    {
+        for (int t = 0; enabled[a] && t < tasks_per_algorithm && count < PORTFOLIO_MAX_MEMBERS; t++)
+        {
+            PortfolioMemberResult *member_result = &result->members[count];
+            member_result->name = names[a];
+
+            members[count].instance = instance;
+            members[count].config = config;
+            members[count].shared = shared;
+            members[count].type = types[a];
+            members[count].initialization_function = initializations[a];
+            members[count].seed = rng_derive(config->seed, (unsigned long long)count);
+            members[count].start_time = start_time;
+            members[count].time_limit = time_limit;
+            members[count].result = member_result;
+            count++;
+        }
+    }
+    result->member_count = count;
+    return count;
+}
+
+// Mode course : un thread par tâche, échanges dès qu'une tâche progresse
+static int portfolio_race(PortfolioMember *members, int count)
+{
+    pthread_t threads[PORTFOLIO_MAX_MEMBERS];
+    int launched[PORTFOLIO_MAX_MEMBERS] = {0};
+    int any_launched = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (pthread_create(&threads[i], NULL, portfolio_member_run, &members[i]) != 0)
+        {
+            perror("Erreur lors de la création d'un thread (portfolio_search)");
+            continue;
+        }
+        launched[i] = 1;
+    }
+    for (int i = 0; i < count; i++)
+    {
+        if (launched[i])
+        {
+            pthread_join(threads[i], NULL);
+            any_launched = 1;
+        }
+    }
+    return any_launched;
+}
+
+typedef struct {
+    PortfolioMember *members;
+    KnapsackSolver **solvers;
+    int budget;
+} EpochWork;
+
+static void create_task(void *arg, int index)
+{
+    EpochWork *work = (EpochWork *)arg;
+    work->solvers[index] = create_member_solver(&work->members[index]);
+}
+
+static void step_task(void *arg, int index)
+{
+    EpochWork *work = (EpochWork *)arg;
+    if (work->solvers[index])
+    {
+        solver_step(work->solvers[index], work->budget);
+    }
+}
+
+// Mode déterministe : époques de taille fixe, échanges dans l'ordre des tâches entre deux époques
+static int portfolio_epochs(const PortfolioConfig *config, PortfolioMember *members, int count, SharedIncumbent *shared, TimeValue start_time, double time_limit)
+{
+    KnapsackSolver *solvers[PORTFOLIO_MAX_MEMBERS] = {NULL};
+    EpochWork work = {members, solvers, config->epoch_budget > 0 ? config->epoch_budget : 1};
+    ThreadPool *pool = config->thread_count > 1 ? thread_pool_create(config->thread_count) : NULL;
+
+    thread_pool_parallel_for(pool, count, create_task, &work);
+
+    int any_created = 0;
+    for (int i = 0; i < count; i++)
+    {
+        any_created |= (solvers[i] != NULL);
+    }
+
+    for (int epoch = 0; any_created && epoch < config->epochs && !time_exceeded(start_time, time_limit) && !shared_target_reached(config, shared); epoch++)
+    {
+        thread_pool_parallel_for(pool, count, step_task, &work);
+
+        // Point de synchronisation : la première tâche (par identifiant) ayant la meilleure valeur l'emporte
+        for (int i = 0; i < count; i++)
+        {
+            if (solvers[i])
+            {
+                publish(&members[i], solver_best(solvers[i]));
+            }
+        }
+        for (int i = 0; i < count; i++)
+        {
+            if (solvers[i] && solver_best(solvers[i])->Z < shared->best->Z)
+            {
+                solver_reseed(solvers[i], shared->best);
+                members[i].result->reseeds++;
+            }
+        }
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        if (solvers[i])
+        {
+            members[i].result->value = solver_best(solvers[i])->Z;
+            members[i].result->work_done = solvers[i]->work_done;
+            solver_destroy(solvers[i]);
+        }
+    }
+    thread_pool_destroy(pool);
+    return any_created;
+}
+
+PortfolioResult portfolio_search(const KnapsackInstance *instance, const PortfolioConfig *config, double time_limit)
+{
+    PortfolioResult result;
+    memset(&result, 0, sizeof(result));
+
+    SharedIncumbent shared;
+    pthread_mutex_init(&shared.lock, NULL);
+    shared.best = init_solution(instance->n);
+    shared.source = "aucun";
+    shared.time_to_best = 0.0;
+    atomic_init(&shared.best_Z, 0);
+
+    PortfolioMember members[PORTFOLIO_MAX_MEMBERS];
+    TimeValue start_time = get_current_time();
+    int count = build_members(instance, config, &shared, start_time, time_limit, members, &result);
+
+    int any_launched = config->deterministic
+                           ? portfolio_epochs(config, members, count, &shared, start_time, time_limit)
+                           : portfolio_race(members, count);
+
+    pthread_mutex_destroy(&shared.lock);
+    if (!any_launched)
+    {
+        free_solution(shared.best);
+        return result;
+    }
+
+    result.best = shared.best;
+    result.best_source = shared.source;
+    result.time_to_best = shared.time_to_best;
+    result.target_reached = config->target > 0 && shared.best->Z >= config->target;
+    return result;
+}
+
+void print_portfolio_result(const PortfolioResult *result)
+{
+    printf("+------------------------------+-------------------------+-------------------------+----------+\n");
+    printf("| %-28s | %-21s | %-21s | %-8s |\n", "Algorithme", "Valeur de la solution", "Unités de travail", "Reprises");
+    printf("+------------------------------+-------------------------+-------------------------+----------+\n");
+    for (int i = 0; i < result->member_count; i++)
+    {
+        const PortfolioMemberResult *member = &result->members[i];
+        printf("| %-28s | %21d | %21ld | %8d |\n", member->name, member->value, member->work_done, member->reseeds);
+    }
+    printf("+------------------------------+-------------------------+-------------------------+----------+\n");
+    if (result->best)
+    {
+        printf("Meilleure solution : Z = %d (trouvée par %s après %.3f s)\n", result->best->Z, result->best_source, result->time_to_best);
+        if (result->target_reached)
+        {
+            printf("Cible atteinte : arrêt anticipé du portefeuille.\n");
+        }
+    }
+}
@@ -0,0 +1,100 @@
+#ifndef PORTFOLIO_H
+#define PORTFOLIO_H
+
+#include "solver.h"
+#include "thread_pool.h"
+
+/**
+ * @brief Nombre maximal de tâches (algorithmes × tâches par algorithme) dans un portefeuille.
+ */
+#define PORTFOLIO_MAX_MEMBERS 64
+
+/**
+ * @brief Paramètres du mode portefeuille.
+ *
+ * Chaque algorithme activé donne `tasks_per_algorithm` tâches logiques, chacune avec sa
+ * graine dérivée de (`seed`, identifiant de tâche). Toutes partagent la meilleure solution
+ * trouvée et s'arrêtent à la même échéance.
+ *
+ * En mode course (`deterministic = 0`), chaque tâche a son propre thread et la solution
+ * partagée est échangée dès qu'une tâche progresse. En mode déterministe, les tâches
+ * avancent par époques de `epoch_budget` unités sur `thread_count` threads, et la solution
+ * partagée n'est échangée qu'entre deux époques, dans l'ordre des tâches : le résultat ne
+ * dépend alors que de la graine et du nombre d'époques, pas du nombre de threads.
+ */
+typedef struct {
+    int use_greedy_vns;    ///< 1 pour lancer le VNS à partir d'une solution gloutonne.
+    int use_random_vns;    ///< 1 pour lancer le VNS à partir d'une solution aléatoire.
+    int use_genetic;       ///< 1 pour lancer l'algorithme génétique.
+    int use_hybrid;        ///< 1 pour lancer l'hybride GA + VNS.
+    int k_perturbation;    ///< Intensité de la perturbation du VNS.
+    int population_size;   ///< Taille de la population du génétique.
+    double mutation_rate;  ///< Taux de mutation du génétique et de l'hybride.
+    int hybrid_population; ///< Taille de la population de l'hybride.
+    int vns_iterations;    ///< Itérations de VNS par enfant dans l'hybride.
+    int hybrid_k;          ///< Intensité de la perturbation du VNS de l'hybride.
+    int step_budget;       ///< Unités de travail entre deux échanges avec la solution partagée.
+    unsigned long long seed; ///< Graine de base ; chaque tâche en dérive la sienne.
+    int tasks_per_algorithm; ///< Nombre de tâches (graines différentes) par algorithme activé.
+    int deterministic;     ///< 1 pour le mode déterministe (indépendant du nombre de threads).
+    int thread_count;      ///< Nombre de threads du mode déterministe.
+    int epochs;            ///< Nombre maximal d'époques du mode déterministe.
+    int epoch_budget;      ///< Unités de travail par tâche et par époque (mode déterministe).
+    int target;            ///< Valeur cible : arrêt dès que la solution partagée l'atteint (0 pour ignorer).
+} PortfolioConfig;
+
+/**
+ * @brief Résultat d'un algorithme du portefeuille.
+ */
+typedef struct {
+    const char *name;      ///< Nom de l'algorithme.
+    int value;             ///< Meilleure valeur connue de l'algorithme à l'échéance (reprises comprises).
+    long work_done;        ///< Unités de travail effectuées.
+    int reseeds;           ///< Nombre de fois où l'algorithme a repris la solution partagée.
+} PortfolioMemberResult;
+
+/**
+ * @brief Résultat d'une exécution du portefeuille.
+ */
+typedef struct {
+    KnapsackSolution *best;   ///< Meilleure solution trouvée (à libérer avec `free_solution`).
+    const char *best_source;  ///< Nom de l'algorithme qui a trouvé la meilleure solution.
+    double time_to_best;      ///< Temps (secondes) écoulé lorsque la meilleure solution a été trouvée.
+    int target_reached;       ///< 1 si la cible a été atteinte (`time_to_best` est alors le temps d'atteinte).
+    int member_count;         ///< Nombre d'algorithmes lancés.
+    PortfolioMemberResult members[PORTFOLIO_MAX_MEMBERS]; ///< Détail par algorithme.
+} PortfolioResult;
+
+/**
+ * @brief Retourne la configuration par défaut du portefeuille (les quatre algorithmes activés).
+ *
+ * @return Une configuration reprenant les paramètres par défaut de `sadm_solver`.
+ */
+PortfolioConfig default_portfolio_config(void);
+
+/**
+ * @brief Fait courir en parallèle les algorithmes configurés jusqu'à une échéance commune.
+ *
+ * Chaque algorithme est piloté par un solveur pas à pas (`solver.h`) sur son propre thread.
+ * Après chaque pas, il publie sa meilleure solution si elle améliore la solution partagée,
+ * et reprend la solution partagée si celle-ci est meilleure que la sienne : un VNS peut
+ * ainsi repartir d'une amélioration trouvée par le génétique.
+ *
+ * @param instance Instance du problème.
+ * @param config Paramètres du portefeuille.
+ * @param time_limit Durée totale en secondes, commune à tous les algorithmes. Elle doit être
+ *        strictement positive en mode course ; en mode déterministe, elle n'est vérifiée
+ *        qu'entre deux époques (0 pour s'arrêter uniquement sur `epochs`), et un arrêt
+ *        sur échéance rend le résultat dépendant de la vitesse de la machine.
+ * @return Le résultat de l'exécution ; `best` vaut `NULL` si aucun algorithme n'a pu être lancé.
+ */
+PortfolioResult portfolio_search(const KnapsackInstance *instance, const PortfolioConfig *config, double time_limit);
+
+/**
+ * @brief Affiche le résultat d'un portefeuille sous forme de tableau.
+ *
+ * @param result Résultat à afficher.
+ */
+void print_portfolio_result(const PortfolioResult *result);
+
+#endif // PORTFOLIO_H
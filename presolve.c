@@ -0,0 +1,162 @@
+#include "presolve.h"
+#include <string.h>
+
+// La contrainte k est-elle dominée par la contrainte l mise à l'échelle ?
+static int dominated_by(const KnapsackInstance *instance, const int *keep_item, int k, int l)
+{
+    // lambda = best_num / best_den, le plus petit facteur tel que W[k] <= lambda W[l]
+    long long best_num = 0;
+    long long best_den = 1;
+    for (int i = 0; i < instance->n; i++)
+    {
+        if (!keep_item[i])
+        {
+            continue;
+        }
+        long long wk = instance->weights[k][i];
+        long long wl = instance->weights[l][i];
+        if (wk <= 0)
+        {
+            continue;
+        }
+        if (wl <= 0)
+        {
+            return 0;
+        }
+        if (wk * best_den > best_num * wl)
+        {
+            best_num = wk;
+            best_den = wl;
+        }
+    }
+    // lambda c[l] <= c[k]
+    return best_num * instance->capacities[l] <= (long long)instance->capacities[k] * best_den;
+}
+
+void presolve_instance(const KnapsackInstance *instance, PresolvedInstance *presolved)
+{
+    int n = instance->n;
+    int m = instance->m;
+    memset(presolved, 0, sizeof(PresolvedInstance));
+    presolved->original_n = n;
+
+    int *keep_item = (int *)malloc(n * sizeof(int));
+    int *keep_constraint = (int *)malloc(m * sizeof(int));
+    if (!keep_item || !keep_constraint)
+    {
+        perror("Erreur d'allocation mémoire (presolve_instance)");
+        exit(EXIT_FAILURE);
+    }
+
+    // Objets qui dépassent seuls une capacité
+    int kept_items = 0;
+    for (int i = 0; i < n; i++)
+    {
+        keep_item[i] = 1;
+        for (int k = 0; k < m && keep_item[i]; k++)
+        {
+            keep_item[i] = instance->weights[k][i] <= instance->capacities[k];
+        }
+        kept_items += keep_item[i];
+    }
+    presolved->removed_items = n - kept_items;
+
+    // Contraintes que les objets restants ne peuvent pas saturer
+    int kept_constraints = m;
+    for (int k = 0; k < m; k++)
+    {
+        long long total = 0;
+        for (int i = 0; i < n; i++)
+        {
+            total += keep_item[i] ? instance->weights[k][i] : 0;
+        }
+        keep_constraint[k] = !(total <= instance->capacities[k] && kept_constraints > 1);
+        if (!keep_constraint[k])
+        {
+            kept_constraints--;
+            presolved->removed_loose++;
+        }
+    }
+
+    // Contraintes dominées par une contrainte conservée
+    for (int k = 0; k < m; k++)
+    {
+        for (int l = 0; l < m && keep_constraint[k] && kept_constraints > 1; l++)
+        {
+            if (l != k && keep_constraint[l] && dominated_by(instance, keep_item, k, l))
+            {
+                keep_constraint[k] = 0;
+                kept_constraints--;
+                presolved->removed_dominated++;
+            }
+        }
+    }
+
+    // Instance réduite
+    KnapsackInstance *reduced = &presolved->reduced;
+    reduced->n = kept_items;
+    reduced->m = kept_constraints;
+    reduced->profits = (int *)malloc((kept_items > 0 ? kept_items : 1) * sizeof(int));
+    reduced->capacities = (int *)malloc(kept_constraints * sizeof(int));
+    reduced->weights = (int **)malloc(kept_constraints * sizeof(int *));
+    presolved->item_map = (int *)malloc((kept_items > 0 ? kept_items : 1) * sizeof(int));
+    presolved->constraint_map = (int *)malloc(kept_constraints * sizeof(int));
+    if (!reduced->profits || !reduced->capacities || !reduced->weights || !presolved->item_map || !presolved->constraint_map)
+    {
+        perror("Erreur d'allocation mémoire (presolve_instance)");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0, j = 0; i < n; i++)
+    {
+        if (keep_item[i])
+        {
+            presolved->item_map[j] = i;
+            reduced->profits[j++] = instance->profits[i];
+        }
+    }
+    for (int k = 0, r = 0; k < m; k++)
+    {
+        if (!keep_constraint[k])
+        {
+            continue;
+        }
+        presolved->constraint_map[r] = k;
+        reduced->capacities[r] = instance->capacities[k];
+        reduced->weights[r] = (int *)malloc((kept_items > 0 ? kept_items : 1) * sizeof(int));
+        if (!reduced->weights[r])
+        {
+            perror("Erreur d'allocation mémoire (presolve_instance)");
+            exit(EXIT_FAILURE);
+        }
+        for (int j = 0; j < kept_items; j++)
+        {
+            reduced->weights[r][j] = instance->weights[k][presolved->item_map[j]];
+        }
+        r++;
+    }
+
+    free(keep_item);
+    free(keep_constraint);
+}
+
+KnapsackSolution *postsolve_solution(const PresolvedInstance *presolved, const KnapsackSolution *solution)
+{
+    KnapsackSolution *original = init_solution(presolved->original_n);
+    for (int j = 0; j < presolved->reduced.n; j++)
+    {
+        original->x[presolved->item_map[j]] = solution->x[j];
+    }
+    original->Z = solution->Z;
+    return original;
+}
+
+void presolve_free(PresolvedInstance *presolved)
+{
+    if (presolved->reduced.weights)
+    {
+        free_knapsack_instance(&presolved->reduced);
+    }
+    free(presolved->item_map);
+    free(presolved->constraint_map);
+    memset(presolved, 0, sizeof(PresolvedInstance));
+}
@@ -0,0 +1,57 @@
+#ifndef PRESOLVE_H
+#define PRESOLVE_H
+
+#include "heuristique.h"
+
+/**
+ * @brief Instance prétraitée, avec la correspondance vers le modèle d'origine.
+ *
+ * Les objets retirés valent 0 dans toute solution ; les contraintes retirées ne peuvent
+ * pas être violées par une solution qui respecte les contraintes restantes. Une solution
+ * de l'instance réduite a donc la même valeur que la solution d'origine correspondante
+ * (`postsolve_solution`), qui est réalisable si elle l'est.
+ */
+typedef struct {
+    KnapsackInstance reduced; ///< Instance réduite (à ne pas libérer séparément).
+    int original_n;           ///< Nombre d'objets du modèle d'origine.
+    int *item_map;            ///< Indice d'origine de chaque objet conservé (`reduced.n` valeurs).
+    int *constraint_map;      ///< Indice d'origine de chaque contrainte conservée (`reduced.m` valeurs).
+    int removed_items;        ///< Objets retirés (ils dépassent seuls une capacité).
+    int removed_loose;        ///< Contraintes retirées car la somme de leurs poids tient dans la capacité.
+    int removed_dominated;    ///< Contraintes retirées car dominées par une autre contrainte mise à l'échelle.
+} PresolvedInstance;
+
+/**
+ * @brief Retire les objets qui ne tiennent jamais et les contraintes redondantes.
+ *
+ * Trois règles, appliquées dans cet ordre :
+ * - un objet dont un poids dépasse la capacité correspondante est retiré ;
+ * - une contrainte dont la somme des poids (objets restants) tient dans la capacité est retirée ;
+ * - la contrainte k est retirée s'il existe une contrainte l conservée et un facteur
+ *   lambda > 0 tels que W[k][i] <= lambda W[l][i] pour tout objet et lambda c[l] <= c[k]
+ *   (le plus petit lambda possible est max_i W[k][i] / W[l][i] ; comparaisons exactes en entiers).
+ *
+ * Une contrainte est toujours conservée, pour que les méthodes restent applicables.
+ *
+ * @param instance Instance d'origine.
+ * @param presolved Instance prétraitée, allouée par la fonction (à libérer avec `presolve_free`).
+ */
+void presolve_instance(const KnapsackInstance *instance, PresolvedInstance *presolved);
+
+/**
+ * @brief Reconstruit la solution du modèle d'origine (objets retirés à 0).
+ *
+ * @param presolved Instance prétraitée.
+ * @param solution Solution de l'instance réduite.
+ * @return La solution d'origine, de même valeur (à libérer avec `free_solution`).
+ */
+KnapsackSolution *postsolve_solution(const PresolvedInstance *presolved, const KnapsackSolution *solution);
+
+/**
+ * @brief Libère une instance prétraitée.
+ *
+ * @param presolved Instance prétraitée à libérer.
+ */
+void presolve_free(PresolvedInstance *presolved);
+
+#endif // PRESOLVE_H
@@ -0,0 +1,69 @@
+#include "rng.h"
+
+// Générateur associé au thread courant (NULL => rand())
+static _Thread_local RngState *bound_rng = NULL;
+
+void rng_seed(RngState *rng, unsigned long long seed)
+{
+    rng->state = seed;
+}
+
+unsigned long long rng_next(RngState *rng)
+{
+    // splitmix64
+    unsigned long long z = (rng->state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+unsigned long long rng_derive(unsigned long long seed, unsigned long long task_id)
+{
+    // Deux tours de splitmix64 pour décorréler les tâches voisines
+    RngState rng;
+    rng_seed(&rng, seed ^ (task_id * 0xD1B54A32D192ED03ULL));
+    rng_next(&rng);
+    return rng_next(&rng);
+}
+
+int rng_int(RngState *rng, int bound)
+{
+    return (int)(rng_next(rng) % (unsigned long long)bound);
+}
+
+double rng_double(RngState *rng)
+{
+    // 53 bits de poids fort => réel uniforme dans [0, 1[
+    return (rng_next(rng) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+RngState *rng_bind(RngState *rng)
+{
+    RngState *previous = bound_rng;
+    bound_rng = rng;
+    return previous;
+}
+
+int rng_rand(void)
+{
+    if (bound_rng == NULL)
+    {
+        return rand();
+    }
+    return (int)(rng_next(bound_rng) % ((unsigned long long)RAND_MAX + 1ULL));
+}
+
+unsigned long long rng_rand64(void)
+{
+    if (bound_rng != NULL)
+    {
+        return rng_next(bound_rng);
+    }
+    // rand() ne garantit que 15 bits : cinq tirages couvrent les 64 bits
+    unsigned long long value = 0;
+    for (int i = 0; i < 5; i++)
+    {
+        value = (value << 15) ^ (unsigned long long)(rand() & 0x7FFF);
+    }
+    return value;
+}
@@ -0,0 +1,90 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <stdlib.h>
+
+/**
+ * @brief État d'un générateur pseudo-aléatoire (splitmix64).
+ *
+ * Contrairement à `rand()`, chaque état est indépendant : deux solveurs qui possèdent
+ * chacun leur `RngState` produisent des suites reproductibles, même lorsqu'ils sont
+ * entrelacés sur un même thread ou exécutés sur des threads différents.
+ */
+typedef struct {
+    unsigned long long state; ///< État interne du générateur.
+} RngState;
+
+/**
+ * @brief Initialise un générateur avec une graine donnée.
+ *
+ * @param rng Pointeur vers le générateur à initialiser.
+ * @param seed Graine du générateur.
+ */
+void rng_seed(RngState *rng, unsigned long long seed);
+
+/**
+ * @brief Dérive la graine d'une tâche logique à partir d'une graine de base.
+ *
+ * La graine ne dépend que du couple (graine, identifiant de tâche), jamais du thread qui
+ * exécute la tâche : c'est ce qui rend les modes parallèles reproductibles quel que soit
+ * le nombre de threads.
+ *
+ * @param seed Graine de base.
+ * @param task_id Identifiant de la tâche logique.
+ * @return La graine de la tâche.
+ */
+unsigned long long rng_derive(unsigned long long seed, unsigned long long task_id);
+
+/**
+ * @brief Tire le prochain entier 64 bits du générateur.
+ *
+ * @param rng Pointeur vers le générateur.
+ * @return Un entier non signé de 64 bits uniformément distribué.
+ */
+unsigned long long rng_next(RngState *rng);
+
+/**
+ * @brief Tire un entier uniforme dans l'intervalle [0, bound[.
+ *
+ * @param rng Pointeur vers le générateur.
+ * @param bound Borne supérieure exclue (doit être strictement positive).
+ * @return Un entier dans [0, bound[.
+ */
+int rng_int(RngState *rng, int bound);
+
+/**
+ * @brief Tire un réel uniforme dans l'intervalle [0, 1[.
+ *
+ * @param rng Pointeur vers le générateur.
+ * @return Un réel dans [0, 1[.
+ */
+double rng_double(RngState *rng);
+
+/**
+ * @brief Associe un générateur au thread courant.
+ *
+ * Tant qu'un générateur est associé, `rng_rand()` l'utilise à la place de `rand()`.
+ * Passer `NULL` restaure le comportement par défaut (`rand()`).
+ *
+ * @param rng Générateur à associer au thread courant, ou `NULL`.
+ * @return Le générateur précédemment associé (pour pouvoir le restaurer).
+ */
+RngState *rng_bind(RngState *rng);
+
+/**
+ * @brief Remplaçant de `rand()` utilisé par les heuristiques.
+ *
+ * @return Un entier dans [0, RAND_MAX], tiré du générateur associé au thread
+ *         courant s'il existe, sinon de `rand()`.
+ */
+int rng_rand(void);
+
+/**
+ * @brief Tire 64 bits aléatoires (masques de croisement uniforme sur des mots de 64 bits).
+ *
+ * @return Un entier 64 bits tiré du générateur associé au thread courant s'il existe,
+ *         sinon assemblé à partir de plusieurs appels à `rand()`.
+ */
+unsigned long long rng_rand64(void);
+
+#endif // RNG_H
@@ -0,0 +1,291 @@
+#include "solution_hash.h"
+
+ZobristTable *zobrist_create(int n, unsigned long long seed)
+{
+    ZobristTable *table = (ZobristTable *)malloc(sizeof(ZobristTable));
+    if (!table)
+    {
+        perror("Erreur d'allocation mémoire pour la table de Zobrist (zobrist_create)");
+        return NULL;
+    }
+    table->n = n;
+    table->keys = (unsigned long long *)malloc(n * sizeof(unsigned long long));
+    if (!table->keys)
+    {
+        perror("Erreur d'allocation mémoire pour les clés de Zobrist (zobrist_create)");
+        free(table);
+        return NULL;
+    }
+
+    RngState rng;
+    rng_seed(&rng, seed);
+    for (int i = 0; i < n; i++)
+    {
+        table->keys[i] = rng_next(&rng);
+    }
+    return table;
+}
+
+unsigned long long zobrist_hash(const ZobristTable *table, const int *x)
+{
+    unsigned long long hash = 0;
+    for (int i = 0; i < table->n; i++)
+    {
+        if (x[i])
+        {
+            hash ^= table->keys[i];
+        }
+    }
+    return hash;
+}
+
+void zobrist_free(ZobristTable *table)
+{
+    if (table != NULL)
+    {
+        free(table->keys);
+        free(table);
+    }
+}
+
+// La case vide est codée par 0 : l'empreinte 0 (solution vide) est décalée
+static unsigned long long slot_key(unsigned long long hash)
+{
+    return hash == 0 ? 1 : hash;
+}
+
+// Case contenant `key`, ou première case vide de sa séquence de sondage
+static int find_slot(const SolutionHashSet *set, unsigned long long key)
+{
+    int mask = set->capacity - 1;
+    int slot = (int)(key & (unsigned long long)mask);
+    while (set->keys[slot] != 0 && set->keys[slot] != key)
+    {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+int hash_set_init(SolutionHashSet *set, int expected)
+{
+    // Facteur de charge au plus 1/2
+    int capacity = 16;
+    while (capacity < 2 * expected)
+    {
+        capacity *= 2;
+    }
+    set->keys = (unsigned long long *)calloc(capacity, sizeof(unsigned long long));
+    set->counts = (int *)calloc(capacity, sizeof(int));
+    if (!set->keys || !set->counts)
+    {
+        perror("Erreur d'allocation mémoire pour l'ensemble d'empreintes (hash_set_init)");
+        free(set->keys);
+        free(set->counts);
+        set->keys = NULL;
+        set->counts = NULL;
+        return -1;
+    }
+    set->capacity = capacity;
+    set->size = 0;
+    return 0;
+}
+
+void hash_set_clear(SolutionHashSet *set)
+{
+    for (int i = 0; i < set->capacity; i++)
+    {
+        set->keys[i] = 0;
+        set->counts[i] = 0;
+    }
+    set->size = 0;
+}
+
+int hash_set_contains(const SolutionHashSet *set, unsigned long long hash)
+{
+    return set->keys[find_slot(set, slot_key(hash))] != 0;
+}
+
+void hash_set_insert(SolutionHashSet *set, unsigned long long hash)
+{
+    unsigned long long key = slot_key(hash);
+    int slot = find_slot(set, key);
+    if (set->keys[slot] == 0)
+    {
+        set->keys[slot] = key;
+        set->size++;
+    }
+    set->counts[slot]++;
+}
+
+void hash_set_remove(SolutionHashSet *set, unsigned long long hash)
+{
+    int slot = find_slot(set, slot_key(hash));
+    if (set->keys[slot] == 0 || --set->counts[slot] > 0)
+    {
+        return;
+    }
+
+    // Suppression par décalage arrière : aucune pierre tombale, les sondages restent courts
+    int mask = set->capacity - 1;
+    int hole = slot;
+    int next = (hole + 1) & mask;
+    while (set->keys[next] != 0)
+    {
+        int home = (int)(set->keys[next] & (unsigned long long)mask);
+        // L'élément peut combler le trou si sa case d'origine n'est pas dans ]hole, next]
+        if (((next - home) & mask) >= ((next - hole) & mask))
+        {
+            set->keys[hole] = set->keys[next];
+            set->counts[hole] = set->counts[next];
+            hole = next;
+        }
+        next = (next + 1) & mask;
+    }
+    set->keys[hole] = 0;
+    set->counts[hole] = 0;
+    set->size--;
+}
+
+void hash_set_free(SolutionHashSet *set)
+{
+    free(set->keys);
+    free(set->counts);
+    set->keys = NULL;
+    set->counts = NULL;
+    set->capacity = 0;
+    set->size = 0;
+}
+
+int solution_cache_init(SolutionCache *cache, int capacity)
+{
+    if (capacity < 1)
+    {
+        capacity = 1;
+    }
+    int buckets = 16;
+    while (buckets < capacity)
+    {
+        buckets *= 2;
+    }
+    cache->entries = (SolutionCacheEntry *)malloc(capacity * sizeof(SolutionCacheEntry));
+    cache->buckets = (int *)malloc(buckets * sizeof(int));
+    if (!cache->entries || !cache->buckets)
+    {
+        perror("Erreur d'allocation mémoire pour le cache de solutions (solution_cache_init)");
+        free(cache->entries);
+        free(cache->buckets);
+        cache->entries = NULL;
+        cache->buckets = NULL;
+        return -1;
+    }
+    for (int b = 0; b < buckets; b++)
+    {
+        cache->buckets[b] = -1;
+    }
+    cache->capacity = capacity;
+    cache->bucket_mask = buckets - 1;
+    cache->size = 0;
+    cache->head = -1;
+    cache->tail = -1;
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->evictions = 0;
+    return 0;
+}
+
+static void lru_unlink(SolutionCache *cache, int e)
+{
+    SolutionCacheEntry *entry = &cache->entries[e];
+    if (entry->lru_prev >= 0)
+        cache->entries[entry->lru_prev].lru_next = entry->lru_next;
+    else
+        cache->head = entry->lru_next;
+    if (entry->lru_next >= 0)
+        cache->entries[entry->lru_next].lru_prev = entry->lru_prev;
+    else
+        cache->tail = entry->lru_prev;
+}
+
+static void lru_push_front(SolutionCache *cache, int e)
+{
+    cache->entries[e].lru_prev = -1;
+    cache->entries[e].lru_next = cache->head;
+    if (cache->head >= 0)
+        cache->entries[cache->head].lru_prev = e;
+    cache->head = e;
+    if (cache->tail < 0)
+        cache->tail = e;
+}
+
+static int cache_find(const SolutionCache *cache, unsigned long long key)
+{
+    int e = cache->buckets[key & (unsigned long long)cache->bucket_mask];
+    while (e >= 0 && cache->entries[e].key != key)
+    {
+        e = cache->entries[e].chain_next;
+    }
+    return e;
+}
+
+int solution_cache_lookup(SolutionCache *cache, unsigned long long key, int *result_Z, unsigned long long *result_hash)
+{
+    int e = cache_find(cache, key);
+    if (e < 0)
+    {
+        cache->misses++;
+        return 0;
+    }
+    cache->hits++;
+    *result_Z = cache->entries[e].result_Z;
+    *result_hash = cache->entries[e].result_hash;
+    if (cache->head != e)
+    {
+        lru_unlink(cache, e);
+        lru_push_front(cache, e);
+    }
+    return 1;
+}
+
+void solution_cache_store(SolutionCache *cache, unsigned long long key, int result_Z, unsigned long long result_hash)
+{
+    int e = cache_find(cache, key);
+    if (e >= 0)
+    {
+        lru_unlink(cache, e);
+    }
+    else
+    {
+        if (cache->size < cache->capacity)
+        {
+            e = cache->size++;
+        }
+        else
+        {
+            // Recycler l'entrée la moins récemment utilisée, après l'avoir retirée de son alvéole
+            e = cache->tail;
+            lru_unlink(cache, e);
+            int *link = &cache->buckets[cache->entries[e].key & (unsigned long long)cache->bucket_mask];
+            while (*link != e)
+            {
+                link = &cache->entries[*link].chain_next;
+            }
+            *link = cache->entries[e].chain_next;
+            cache->evictions++;
+        }
+        int bucket = (int)(key & (unsigned long long)cache->bucket_mask);
+        cache->entries[e].key = key;
+        cache->entries[e].chain_next = cache->buckets[bucket];
+        cache->buckets[bucket] = e;
+    }
+    cache->entries[e].result_Z = result_Z;
+    cache->entries[e].result_hash = result_hash;
+    lru_push_front(cache, e);
+}
+
+void solution_cache_free(SolutionCache *cache)
+{
+    free(cache->entries);
+    free(cache->buckets);
+    cache->entries = NULL;
+    cache->buckets = NULL;
+}
@@ -0,0 +1,189 @@
+#ifndef SOLUTION_HASH_H
+#define SOLUTION_HASH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "rng.h"
+
+/**
+ * @brief Table de Zobrist : une clé aléatoire de 64 bits par objet.
+ *
+ * L'empreinte d'une solution est le XOR des clés de ses objets sélectionnés. Inverser
+ * l'objet i revient à faire `hash ^= keys[i]` : l'empreinte se met à jour en O(1) par flip.
+ */
+typedef struct {
+    int n;                     ///< Nombre d'objets.
+    unsigned long long *keys;  ///< Clé de chaque objet.
+} ZobristTable;
+
+/**
+ * @brief Ensemble (multi-ensemble) d'empreintes de solutions, à adressage ouvert.
+ *
+ * Chaque empreinte est associée à un compteur, ce qui permet de retirer un individu
+ * sans perdre la trace de ses éventuels clones restés dans la population.
+ */
+typedef struct {
+    unsigned long long *keys; ///< Empreintes (0 = case vide).
+    int *counts;              ///< Nombre d'occurrences de chaque empreinte.
+    int capacity;             ///< Nombre de cases (puissance de 2).
+    int size;                 ///< Nombre d'empreintes distinctes.
+} SolutionHashSet;
+
+/**
+ * @brief Entrée du cache de solutions (chaînée dans son alvéole et dans la liste LRU).
+ */
+typedef struct {
+    unsigned long long key;         ///< Empreinte de la solution de départ.
+    unsigned long long result_hash; ///< Empreinte de la solution obtenue.
+    int result_Z;                   ///< Valeur de la solution obtenue.
+    int lru_prev;                   ///< Entrée plus récemment utilisée (-1 en tête).
+    int lru_next;                   ///< Entrée moins récemment utilisée (-1 en queue).
+    int chain_next;                 ///< Entrée suivante de la même alvéole (-1 en fin).
+} SolutionCacheEntry;
+
+/**
+ * @brief Cache borné associant l'empreinte d'une solution à un résultat (valeur et empreinte).
+ *
+ * Les entrées sont préallouées ; une fois le cache plein, l'entrée la moins récemment
+ * utilisée est recyclée (éviction LRU). Les compteurs permettent de mesurer le taux de succès.
+ */
+typedef struct {
+    SolutionCacheEntry *entries; ///< Entrées préallouées.
+    int *buckets;                ///< Première entrée de chaque alvéole (-1 si vide).
+    int capacity;                ///< Nombre maximal d'entrées.
+    int bucket_mask;             ///< Nombre d'alvéoles - 1 (puissance de 2).
+    int size;                    ///< Nombre d'entrées utilisées.
+    int head;                    ///< Entrée la plus récemment utilisée.
+    int tail;                    ///< Entrée la moins récemment utilisée.
+    long hits;                   ///< Recherches fructueuses.
+    long misses;                 ///< Recherches infructueuses.
+    long evictions;              ///< Entrées recyclées.
+} SolutionCache;
+
+/**
+ * @brief Crée une table de Zobrist.
+ *
+ * Les clés sont tirées d'un générateur propre, initialisé avec `seed` : elles ne consomment
+ * pas le générateur des heuristiques.
+ *
+ * @param n Nombre d'objets.
+ * @param seed Graine des clés.
+ * @return La table, ou `NULL` en cas d'erreur d'allocation.
+ */
+ZobristTable *zobrist_create(int n, unsigned long long seed);
+
+/**
+ * @brief Calcule l'empreinte d'une solution en O(n).
+ *
+ * @param table Table de Zobrist.
+ * @param x Vecteur de sélection (0/1) de taille `table->n`.
+ * @return L'empreinte de la solution.
+ */
+unsigned long long zobrist_hash(const ZobristTable *table, const int *x);
+
+/**
+ * @brief Met à jour une empreinte après l'inversion de l'objet i (O(1)).
+ *
+ * @param table Table de Zobrist.
+ * @param hash Empreinte avant l'inversion.
+ * @param i Indice de l'objet inversé.
+ * @return L'empreinte après l'inversion.
+ */
+static inline unsigned long long zobrist_flip(const ZobristTable *table, unsigned long long hash, int i)
+{
+    return hash ^ table->keys[i];
+}
+
+/**
+ * @brief Libère une table de Zobrist.
+ *
+ * @param table Table à libérer (peut être `NULL`).
+ */
+void zobrist_free(ZobristTable *table);
+
+/**
+ * @brief Initialise un ensemble d'empreintes pouvant contenir `expected` éléments.
+ *
+ * @param set Ensemble à initialiser.
+ * @param expected Nombre maximal d'empreintes attendues.
+ * @return 0 en cas de succès, -1 en cas d'erreur d'allocation.
+ */
+int hash_set_init(SolutionHashSet *set, int expected);
+
+/**
+ * @brief Vide l'ensemble (O(capacité)).
+ *
+ * @param set Ensemble à vider.
+ */
+void hash_set_clear(SolutionHashSet *set);
+
+/**
+ * @brief Indique si une empreinte est présente.
+ *
+ * @param set Ensemble consulté.
+ * @param hash Empreinte recherchée.
+ * @return 1 si l'empreinte est présente, 0 sinon.
+ */
+int hash_set_contains(const SolutionHashSet *set, unsigned long long hash);
+
+/**
+ * @brief Ajoute une occurrence d'une empreinte.
+ *
+ * @param set Ensemble modifié (sa capacité doit couvrir `expected` empreintes distinctes).
+ * @param hash Empreinte à ajouter.
+ */
+void hash_set_insert(SolutionHashSet *set, unsigned long long hash);
+
+/**
+ * @brief Retire une occurrence d'une empreinte (sans effet si elle est absente).
+ *
+ * @param set Ensemble modifié.
+ * @param hash Empreinte à retirer.
+ */
+void hash_set_remove(SolutionHashSet *set, unsigned long long hash);
+
+/**
+ * @brief Libère la mémoire d'un ensemble d'empreintes.
+ *
+ * @param set Ensemble à libérer.
+ */
+void hash_set_free(SolutionHashSet *set);
+
+/**
+ * @brief Initialise un cache de solutions.
+ *
+ * @param cache Cache à initialiser.
+ * @param capacity Nombre maximal d'entrées (au moins 1).
+ * @return 0 en cas de succès, -1 en cas d'erreur d'allocation.
+ */
+int solution_cache_init(SolutionCache *cache, int capacity);
+
+/**
+ * @brief Recherche une empreinte et, si elle est présente, la marque comme la plus récente.
+ *
+ * @param cache Cache consulté (les compteurs sont mis à jour).
+ * @param key Empreinte de la solution de départ.
+ * @param result_Z Reçoit la valeur du résultat si l'empreinte est présente.
+ * @param result_hash Reçoit l'empreinte du résultat si l'empreinte est présente.
+ * @return 1 si l'empreinte est présente, 0 sinon.
+ */
+int solution_cache_lookup(SolutionCache *cache, unsigned long long key, int *result_Z, unsigned long long *result_hash);
+
+/**
+ * @brief Enregistre (ou met à jour) le résultat associé à une empreinte.
+ *
+ * @param cache Cache modifié ; l'entrée la moins récente est évincée s'il est plein.
+ * @param key Empreinte de la solution de départ.
+ * @param result_Z Valeur du résultat.
+ * @param result_hash Empreinte du résultat.
+ */
+void solution_cache_store(SolutionCache *cache, unsigned long long key, int result_Z, unsigned long long result_hash);
+
+/**
+ * @brief Libère la mémoire d'un cache de solutions.
+ *
+ * @param cache Cache à libérer.
+ */
+void solution_cache_free(SolutionCache *cache);
+
+#endif // SOLUTION_HASH_H
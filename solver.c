@@ -0,0 +1,254 @@
+#include "solver.h"
+
+static KnapsackSolver *solver_alloc(SolverType type, const KnapsackInstance *instance, unsigned long long seed)
+{
+    KnapsackSolver *solver = (KnapsackSolver *)calloc(1, sizeof(KnapsackSolver));
+    if (!solver)
+    {
+        perror("Erreur d'allocation mémoire pour le solveur (solver_alloc)");
+        return NULL;
+    }
+    solver->type = type;
+    solver->instance = instance;
+    rng_seed(&solver->rng, seed);
+    solver->best = init_solution(instance->n);
+    return solver;
+}
+
+static int solver_alloc_populations(KnapsackSolver *solver, int population_size, double mutation_rate)
+{
+    solver->population_size = population_size;
+    solver->mutation_rate = mutation_rate;
+    // Les individus initiaux sont construits paresseusement par solver_step
+    solver->population = (Individual *)calloc(population_size, sizeof(Individual));
+    solver->offspring = (Individual *)calloc(population_size, sizeof(Individual));
+    if (!solver->population || !solver->offspring)
+    {
+        perror("Erreur d'allocation mémoire pour la population (solver_alloc_populations)");
+        return 0;
+    }
+    // Les enfants sont écrits en place : leurs solutions sont allouées une seule fois
+    for (int i = 0; i < population_size; i++)
+    {
+        solver->offspring[i].solution = init_solution(solver->instance->n);
+    }
+    return 1;
+}
+
+static void solver_update_best(KnapsackSolver *solver, const KnapsackSolution *solution)
+{
+    if (solution->Z > solver->best->Z)
+    {
+        copy_solution_into(solver->best, solution, solver->instance->n);
+    }
+}
+
+KnapsackSolver *solver_create_vns(const KnapsackInstance *instance, KnapsackSolution *(*initialization_function)(const KnapsackInstance *), int k_perturbation, unsigned long long seed)
+{
+    KnapsackSolver *solver = solver_alloc(SOLVER_VNS, instance, seed);
+    if (!solver)
+    {
+        return NULL;
+    }
+    solver->k_perturbation = k_perturbation;
+
+    // La construction initiale consomme le générateur du solveur
+    RngState *previous = rng_bind(&solver->rng);
+    solver->current = initialization_function(instance);
+    rng_bind(previous);
+
+    solver_update_best(solver, solver->current);
+    return solver;
+}
+
+KnapsackSolver *solver_create_genetic(const KnapsackInstance *instance, int population_size, double mutation_rate, unsigned long long seed)
+{
+    KnapsackSolver *solver = solver_alloc(SOLVER_GENETIC, instance, seed);
+    if (!solver)
+    {
+        return NULL;
+    }
+    if (!solver_alloc_populations(solver, population_size, mutation_rate))
+    {
+        solver_destroy(solver);
+        return NULL;
+    }
+    return solver;
+}
+
+KnapsackSolver *solver_create_hybrid(const KnapsackInstance *instance, int population_size, double mutation_rate, int vns_iterations, int k, unsigned long long seed)
+{
+    KnapsackSolver *solver = solver_alloc(SOLVER_HYBRID, instance, seed);
+    if (!solver)
+    {
+        return NULL;
+    }
+    solver->vns_iterations = vns_iterations;
+    solver->k_perturbation = k;
+    if (!solver_alloc_populations(solver, population_size, mutation_rate))
+    {
+        solver_destroy(solver);
+        return NULL;
+    }
+    return solver;
+}
+
+// Une itération de VNS : perturbation, VND, puis acceptation ou retour à la meilleure solution
+static void vns_unit(KnapsackSolver *solver)
+{
+    const KnapsackInstance *instance = solver->instance;
+
+    if (!solver->descended)
+    {
+        variable_neighborhood_descent(solver->current, instance, 0);
+        solver_update_best(solver, solver->current);
+        solver->descended = 1;
+        return;
+    }
+
+    random_flip(solver->current, instance, solver->k_perturbation);
+    evaluate_solution(solver->current, instance);
+    variable_neighborhood_descent(solver->current, instance, 0);
+
+    if (solver->current->Z > solver->best->Z)
+    {
+        copy_solution_into(solver->best, solver->current, instance->n);
+    }
+    else
+    {
+        copy_solution_into(solver->current, solver->best, instance->n);
+    }
+}
+
+// Construit un individu initial, ou un enfant de la génération en cours
+static void genetic_unit(KnapsackSolver *solver)
+{
+    const KnapsackInstance *instance = solver->instance;
+
+    if (solver->initialized < solver->population_size)
+    {
+        Individual *individual = &solver->population[solver->initialized];
+        individual->solution = random_initial_solution(instance);
+        individual->fitness = individual->solution->Z;
+        solver_update_best(solver, individual->solution);
+        solver->initialized++;
+        return;
+    }
+
+    Individual *parent1 = tournament_selection(solver->population, solver->population_size);
+    Individual *parent2 = tournament_selection(solver->population, solver->population_size);
+    Individual *child = &solver->offspring[solver->child_index];
+
+    crossover(parent1->solution, parent2->solution, child->solution, instance);
+    mutate(child->solution, instance, solver->mutation_rate);
+    evaluate_solution(child->solution, instance);
+
+    if (solver->type == SOLVER_HYBRID)
+    {
+        variable_neighborhood_search_budget(child->solution, instance, solver->vns_iterations, solver->k_perturbation, solver->deadline_start, solver->deadline_limit);
+    }
+
+    child->fitness = child->solution->Z;
+    solver_update_best(solver, child->solution);
+
+    // Génération complète : les deux populations échangent leurs rôles
+    if (++solver->child_index == solver->population_size)
+    {
+        Individual *swap = solver->population;
+        solver->population = solver->offspring;
+        solver->offspring = swap;
+        solver->child_index = 0;
+        solver->generation++;
+    }
+}
+
+int solver_step(KnapsackSolver *solver, int budget)
+{
+    RngState *previous = rng_bind(&solver->rng);
+    // Les descentes du pas s'arrêtent elles aussi à l'échéance
+    set_descent_deadline(solver->deadline_start, solver->deadline_limit);
+
+    int done = 0;
+    for (; done < budget; done++)
+    {
+        if (time_exceeded(solver->deadline_start, solver->deadline_limit))
+        {
+            break;
+        }
+        if (solver->type == SOLVER_VNS)
+        {
+            vns_unit(solver);
+        }
+        else
+        {
+            genetic_unit(solver);
+        }
+    }
+
+    set_descent_deadline(solver->deadline_start, 0);
+    rng_bind(previous);
+    solver->work_done += done;
+    return done;
+}
+
+void solver_set_deadline(KnapsackSolver *solver, TimeValue start_time, double time_limit)
+{
+    solver->deadline_start = start_time;
+    solver->deadline_limit = time_limit;
+}
+
+void solver_reseed(KnapsackSolver *solver, const KnapsackSolution *solution)
+{
+    const KnapsackInstance *instance = solver->instance;
+
+    if (solver->type == SOLVER_VNS)
+    {
+        copy_solution_into(solver->current, solution, instance->n);
+        solver->descended = 0;
+    }
+    else if (solver->initialized == solver->population_size)
+    {
+        // Remplacer le plus mauvais individu de la population courante
+        Individual *worst = &solver->population[0];
+        for (int i = 1; i < solver->population_size; i++)
+        {
+            if (solver->population[i].fitness < worst->fitness)
+            {
+                worst = &solver->population[i];
+            }
+        }
+        copy_solution_into(worst->solution, solution, instance->n);
+        worst->fitness = solution->Z;
+    }
+    solver_update_best(solver, solution);
+}
+
+const KnapsackSolution *solver_best(const KnapsackSolver *solver)
+{
+    return solver->best;
+}
+
+void solver_destroy(KnapsackSolver *solver)
+{
+    if (solver == NULL)
+    {
+        return;
+    }
+    if (solver->best)
+    {
+        free_solution(solver->best);
+    }
+    if (solver->current)
+    {
+        free_solution(solver->current);
+    }
+    if (solver->population)
+    {
+        free_population(solver->population, solver->population_size);
+    }
+    if (solver->offspring)
+    {
+        free_population(solver->offspring, solver->population_size);
+    }
+    free(solver);
+}
@@ -0,0 +1,149 @@
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include "genetic.h"
+#include "rng.h"
+
+/**
+ * @brief Algorithme piloté par un objet solveur.
+ */
+typedef enum {
+    SOLVER_VNS,     ///< Recherche à voisinage variable (VNS).
+    SOLVER_GENETIC, ///< Algorithme génétique.
+    SOLVER_HYBRID   ///< Hybride GA + VNS.
+} SolverType;
+
+/**
+ * @brief Solveur reprenable pas à pas.
+ *
+ * Contrairement à `variable_neighborhood_search`, `genetic_algorithm` et `hybrid_GA_VNS`,
+ * qui s'exécutent d'un bloc jusqu'à leur terme (ou jusqu'au `longjmp` du timeout),
+ * un solveur conserve tout son état entre deux appels à `solver_step`. Un hôte peut
+ * donc entrelacer de nombreux solveurs sur quelques threads, consulter la meilleure
+ * solution à tout moment ou prolonger une exécution sans la recommencer.
+ *
+ * Chaque solveur possède son propre générateur aléatoire : deux solveurs créés avec
+ * la même graine produisent la même suite de solutions, quel que soit l'entrelacement.
+ *
+ * L'unité de travail d'un pas dépend de l'algorithme :
+ * - VNS : une itération (perturbation + VND + acceptation) ;
+ * - génétique : la construction d'un individu initial ou d'un enfant ;
+ * - hybride : la construction d'un individu initial ou d'un enfant suivi de son VNS.
+ */
+typedef struct {
+    SolverType type;                   ///< Algorithme piloté.
+    const KnapsackInstance *instance;  ///< Instance à résoudre (non possédée).
+    RngState rng;                      ///< Générateur aléatoire propre au solveur.
+    KnapsackSolution *best;            ///< Meilleure solution trouvée jusqu'ici.
+    long work_done;                    ///< Nombre total d'unités de travail effectuées.
+
+    // VNS
+    KnapsackSolution *current;         ///< Solution courante du VNS.
+    int k_perturbation;                ///< Intensité de la perturbation (VNS et hybride).
+    int descended;                     ///< 1 si la VND initiale a été effectuée.
+
+    // Génétique / hybride
+    Individual *population;            ///< Population courante.
+    Individual *offspring;             ///< Population en cours de construction.
+    int population_size;               ///< Taille de la population.
+    int initialized;                   ///< Nombre d'individus initiaux déjà construits.
+    int child_index;                   ///< Prochain enfant à construire dans `offspring`.
+    int generation;                    ///< Nombre de générations terminées.
+    double mutation_rate;              ///< Taux de mutation.
+    int vns_iterations;                ///< Itérations de VNS appliquées à chaque enfant (hybride).
+
+    // Échéance optionnelle
+    TimeValue deadline_start;          ///< Temps de départ de l'échéance.
+    double deadline_limit;             ///< Durée de l'échéance en secondes (0 pour aucune).
+} KnapsackSolver;
+
+/**
+ * @brief Crée un solveur VNS.
+ *
+ * @param instance Instance du problème (doit rester valide pendant toute la vie du solveur).
+ * @param initialization_function Fonction de construction de la solution initiale
+ *        (`greedy_initial_solution` ou `random_initial_solution`).
+ * @param k_perturbation Intensité de la perturbation.
+ * @param seed Graine du générateur aléatoire du solveur.
+ * @return Un pointeur vers le solveur, ou `NULL` en cas d'erreur d'allocation.
+ */
+KnapsackSolver *solver_create_vns(const KnapsackInstance *instance, KnapsackSolution *(*initialization_function)(const KnapsackInstance *), int k_perturbation, unsigned long long seed);
+
+/**
+ * @brief Crée un solveur génétique.
+ *
+ * @param instance Instance du problème (doit rester valide pendant toute la vie du solveur).
+ * @param population_size Taille de la population.
+ * @param mutation_rate Taux de mutation.
+ * @param seed Graine du générateur aléatoire du solveur.
+ * @return Un pointeur vers le solveur, ou `NULL` en cas d'erreur d'allocation.
+ */
+KnapsackSolver *solver_create_genetic(const KnapsackInstance *instance, int population_size, double mutation_rate, unsigned long long seed);
+
+/**
+ * @brief Crée un solveur hybride GA + VNS.
+ *
+ * @param instance Instance du problème (doit rester valide pendant toute la vie du solveur).
+ * @param population_size Taille de la population.
+ * @param mutation_rate Taux de mutation.
+ * @param vns_iterations Nombre d'itérations de VNS appliquées à chaque enfant.
+ * @param k Intensité de la perturbation du VNS.
+ * @param seed Graine du générateur aléatoire du solveur.
+ * @return Un pointeur vers le solveur, ou `NULL` en cas d'erreur d'allocation.
+ */
+KnapsackSolver *solver_create_hybrid(const KnapsackInstance *instance, int population_size, double mutation_rate, int vns_iterations, int k, unsigned long long seed);
+
+/**
+ * @brief Exécute au plus `budget` unités de travail puis rend la main.
+ *
+ * @param solver Solveur à faire avancer.
+ * @param budget Nombre maximal d'unités de travail à effectuer.
+ * @return Le nombre d'unités effectivement effectuées.
+ */
+int solver_step(KnapsackSolver *solver, int budget);
+
+/**
+ * @brief Fixe une échéance au-delà de laquelle `solver_step` rend la main.
+ *
+ * L'échéance est vérifiée avant chaque unité de travail, pour l'hybride entre deux
+ * itérations du VNS appliqué à un enfant, et dans les descentes (`set_descent_deadline`)
+ * avant chaque objet examiné : un pas peut donc s'arrêter avant d'avoir consommé tout son
+ * budget, et même au milieu d'une VND.
+ *
+ * @param solver Solveur concerné.
+ * @param start_time Temps de départ de l'échéance.
+ * @param time_limit Durée en secondes à partir de `start_time` (0 pour supprimer l'échéance).
+ */
+void solver_set_deadline(KnapsackSolver *solver, TimeValue start_time, double time_limit);
+
+/**
+ * @brief Injecte une solution extérieure dans le solveur.
+ *
+ * Pour le VNS, la solution remplace la solution courante ; pour le génétique et l'hybride,
+ * elle remplace le plus mauvais individu de la population. Dans tous les cas, elle devient
+ * la meilleure solution du solveur si elle l'améliore.
+ *
+ * @param solver Solveur concerné.
+ * @param solution Solution faisable à injecter (copiée).
+ */
+void solver_reseed(KnapsackSolver *solver, const KnapsackSolution *solution);
+
+/**
+ * @brief Retourne la meilleure solution trouvée jusqu'ici.
+ *
+ * La solution reste la propriété du solveur ; la copier (`copy_knapsack_solution`)
+ * si elle doit survivre à `solver_destroy`.
+ *
+ * @param solver Solveur à interroger.
+ * @return Un pointeur vers la meilleure solution.
+ */
+const KnapsackSolution *solver_best(const KnapsackSolver *solver);
+
+/**
+ * @brief Libère un solveur et toutes les solutions qu'il possède.
+ *
+ * @param solver Solveur à libérer (peut être `NULL`).
+ */
+void solver_destroy(KnapsackSolver *solver);
+
+#endif // SOLVER_H
@@ -0,0 +1,271 @@
+#include "surrogate.h"
+#include <math.h>
+#include <string.h>
+
+#define SURROGATE_NODE_LIMIT 2000000L
+#define SURROGATE_EPSILON 1e-9
+#define SURROGATE_STEP 0.5
+#define SURROGATE_MIN_MULTIPLIER 1e-3 // Plancher relatif à la moyenne des multiplicateurs de départ
+
+// Ratios de référence pour qsort (propres à chaque thread)
+static _Thread_local const int *sort_profits = NULL;
+static _Thread_local const double *sort_weights = NULL;
+
+// Ratio profit/poids décroissant, objets sans poids en tête
+static int compare_ratio(const void *a, const void *b)
+{
+    int i = *(const int *)a;
+    int j = *(const int *)b;
+    double lhs = sort_profits[i] * sort_weights[j];
+    double rhs = sort_profits[j] * sort_weights[i];
+    if (lhs != rhs)
+    {
+        return (lhs < rhs) - (lhs > rhs);
+    }
+    return i - j;
+}
+
+typedef struct {
+    int n;
+    const int *order;
+    const int *profits;
+    const double *weights;
+    const double *prefix_weight; // Somme des poids des objets order[0..j-1]
+    const long *prefix_profit;   // Somme des profits des objets order[0..j-1]
+    int *current;
+    int *best_x;
+    long best;
+    long nodes;
+    long node_limit;
+} KnapsackSearch;
+
+// Borne de Dantzig des objets order[k..] avec la capacité restante
+static double dantzig_bound(const KnapsackSearch *search, int k, double capacity)
+{
+    // Premier objet (rang b) qui ne tient plus dans la continuité de k
+    int low = k;
+    int high = search->n;
+    while (low < high)
+    {
+        int mid = (low + high) / 2;
+        if (search->prefix_weight[mid + 1] - search->prefix_weight[k] <= capacity)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    double bound = (double)(search->prefix_profit[low] - search->prefix_profit[k]);
+    if (low < search->n)
+    {
+        int i = search->order[low];
+        double rest = capacity - (search->prefix_weight[low] - search->prefix_weight[k]);
+        bound += rest * search->profits[i] / search->weights[i];
+    }
+    return bound;
+}
+
+static void knapsack_dfs(KnapsackSearch *search, int k, double capacity, long profit)
+{
+    if (profit > search->best)
+    {
+        search->best = profit;
+        memcpy(search->best_x, search->current, search->n * sizeof(int));
+    }
+    if (k == search->n || search->nodes++ >= search->node_limit)
+    {
+        return;
+    }
+    // Profits entiers : élagage dès que la partie entière de la borne n'améliore pas
+    if (profit + (long)floor(dantzig_bound(search, k, capacity) + SURROGATE_EPSILON) <= search->best)
+    {
+        return;
+    }
+    int i = search->order[k];
+    if (search->weights[i] <= capacity)
+    {
+        search->current[i] = 1;
+        knapsack_dfs(search, k + 1, capacity - search->weights[i], profit + search->profits[i]);
+        search->current[i] = 0;
+    }
+    knapsack_dfs(search, k + 1, capacity, profit);
+}
+
+int surrogate_knapsack(const int *profits, const double *weights, int n, double capacity, long node_limit, int *x, int *exact)
+{
+    int *order = (int *)malloc(n * sizeof(int));
+    double *prefix_weight = (double *)malloc((n + 1) * sizeof(double));
+    long *prefix_profit = (long *)malloc((n + 1) * sizeof(long));
+    int *current = (int *)calloc(n, sizeof(int));
+    if (!order || !prefix_weight || !prefix_profit || !current)
+    {
+        perror("Erreur d'allocation mémoire (surrogate_knapsack)");
+        exit(EXIT_FAILURE);
+    }
+
+    // Tolérance : une solution du MKP ne doit pas être exclue par un arrondi
+    capacity += SURROGATE_EPSILON * (fabs(capacity) + 1.0);
+
+    for (int i = 0; i < n; i++)
+    {
+        order[i] = i;
+        x[i] = 0;
+    }
+    sort_profits = profits;
+    sort_weights = weights;
+    qsort(order, n, sizeof(int), compare_ratio);
+    prefix_weight[0] = 0.0;
+    prefix_profit[0] = 0;
+    for (int k = 0; k < n; k++)
+    {
+        prefix_weight[k + 1] = prefix_weight[k] + weights[order[k]];
+        prefix_profit[k + 1] = prefix_profit[k] + profits[order[k]];
+    }
+
+    KnapsackSearch search = {n, order, profits, weights, prefix_weight, prefix_profit, current, x, 0, 0, node_limit};
+    knapsack_dfs(&search, 0, capacity, 0);
+    *exact = search.nodes < node_limit;
+    long value = *exact ? search.best : (long)floor(dantzig_bound(&search, 0, capacity) + SURROGATE_EPSILON);
+
+    free(order);
+    free(prefix_weight);
+    free(prefix_profit);
+    free(current);
+    return (int)value;
+}
+
+int surrogate_solve(const KnapsackInstance *instance, int iterations, SurrogateRelaxation *sr)
+{
+    int n = instance->n;
+    int m = instance->m;
+    memset(sr, 0, sizeof(SurrogateRelaxation));
+    sr->multipliers = (double *)calloc(m, sizeof(double));
+    sr->x = (int *)calloc(n, sizeof(int));
+    double *multipliers = (double *)malloc(m * sizeof(double));
+    double *weights = (double *)malloc(n * sizeof(double));
+    double *violations = (double *)malloc(m * sizeof(double));
+    int *x = (int *)malloc(n * sizeof(int));
+    if (!sr->multipliers || !sr->x || !multipliers || !weights || !violations || !x)
+    {
+        perror("Erreur d'allocation mémoire (surrogate_solve)");
+        exit(EXIT_FAILURE);
+    }
+
+    // Départ : variables duales de la relaxation linéaire (1/c[k] si elles sont toutes nulles),
+    // avec un plancher positif : la mise à jour multiplicative ne relèverait jamais un multiplicateur nul
+    LpRelaxation lp;
+    int status = lp_solve(instance, NULL, &lp);
+    double total = 0.0;
+    for (int k = 0; k < m && status == 0; k++)
+    {
+        total += lp.duals[k];
+    }
+    double floor_value = SURROGATE_MIN_MULTIPLIER * total / m;
+    for (int k = 0; k < m; k++)
+    {
+        multipliers[k] = total > 0 ? fmax(lp.duals[k], floor_value) : 1.0 / instance->capacities[k];
+    }
+    lp_free(&lp);
+    if (status != 0)
+    {
+        free(multipliers);
+        free(weights);
+        free(violations);
+        free(x);
+        return -1;
+    }
+
+    sr->bound = -1;
+    double step = SURROGATE_STEP;
+    for (int it = 0; it < iterations; it++)
+    {
+        // Normalisation (somme 1), puis sac à dos agrégé
+        double sum = 0.0;
+        for (int k = 0; k < m; k++)
+        {
+            sum += multipliers[k];
+        }
+        double capacity = 0.0;
+        for (int k = 0; k < m; k++)
+        {
+            multipliers[k] /= sum;
+            capacity += multipliers[k] * instance->capacities[k];
+        }
+        for (int i = 0; i < n; i++)
+        {
+            weights[i] = 0.0;
+            for (int k = 0; k < m; k++)
+            {
+                weights[i] += multipliers[k] * instance->weights[k][i];
+            }
+        }
+        int exact;
+        int bound = surrogate_knapsack(instance->profits, weights, n, capacity, SURROGATE_NODE_LIMIT, x, &exact);
+        sr->iterations++;
+        if (sr->bound < 0 || bound < sr->bound)
+        {
+            sr->bound = bound;
+            memcpy(sr->multipliers, multipliers, m * sizeof(double));
+            memcpy(sr->x, x, n * sizeof(int));
+        }
+        if (!exact)
+        {
+            continue;
+        }
+
+        // Violations relatives de l'optimum surrogate
+        double largest = 0.0;
+        for (int k = 0; k < m; k++)
+        {
+            long load = 0;
+            for (int i = 0; i < n; i++)
+            {
+                if (x[i])
+                {
+                    load += instance->weights[k][i];
+                }
+            }
+            violations[k] = (double)(load - instance->capacities[k]) / instance->capacities[k];
+            if (violations[k] > largest)
+            {
+                largest = violations[k];
+            }
+        }
+        if (largest <= 0)
+        {
+            // L'optimum surrogate est réalisable : il est optimal pour le MKP
+            sr->optimal = bound <= sr->bound;
+            break;
+        }
+        // Pirkul : poids accru sur les contraintes violées, réduit sur les contraintes lâches
+        for (int k = 0; k < m; k++)
+        {
+            multipliers[k] *= exp(step * violations[k] / largest);
+        }
+        step *= 0.9;
+    }
+
+    free(multipliers);
+    free(weights);
+    free(violations);
+    free(x);
+    return 0;
+}
+
+void surrogate_free(SurrogateRelaxation *sr)
+{
+    free(sr->multipliers);
+    free(sr->x);
+    sr->multipliers = NULL;
+    sr->x = NULL;
+}
+
+int *surrogate_utility_order(const KnapsackInstance *instance, int iterations)
+{
+    SurrogateRelaxation sr;
+    int *order = surrogate_solve(instance, iterations, &sr) == 0 ? dual_utility_order(instance, sr.multipliers) : efficiency_order(instance);
+    surrogate_free(&sr);
+    return order;
+}
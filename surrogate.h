@@ -0,0 +1,69 @@
+#ifndef SURROGATE_H
+#define SURROGATE_H
+
+#include "lp.h"
+
+/**
+ * @brief Relaxation surrogate du MKP : les m contraintes agrégées en une seule.
+ *
+ * Pour des multiplicateurs w >= 0, toute solution du MKP vérifie
+ * sum_i (sum_k w[k] W[k][i]) x[i] <= sum_k w[k] c[k] : l'optimum de ce sac à dos à une
+ * contrainte est une borne supérieure du MKP. Partant des variables duales de la
+ * relaxation linéaire (dont la borne surrogate est déjà au moins aussi bonne que la
+ * borne LP), relevées à un petit plancher positif pour que la mise à jour multiplicative
+ * puisse atteindre toutes les contraintes, les multiplicateurs sont ajustés à la Pirkul :
+ * les contraintes que viole l'optimum surrogate voient leur poids augmenter.
+ */
+typedef struct {
+    int bound;            ///< Meilleure (plus petite) borne supérieure obtenue.
+    double *multipliers;  ///< Multiplicateurs (somme 1) ayant donné `bound` (m valeurs).
+    int *x;               ///< Optimum du sac à dos surrogate pour ces multiplicateurs (n valeurs).
+    int optimal;          ///< 1 si `x` respecte toutes les contraintes : c'est alors un optimum du MKP.
+    int iterations;       ///< Nombre de sacs à dos surrogate résolus.
+} SurrogateRelaxation;
+
+/**
+ * @brief Résout le sac à dos à une contrainte (poids réels, profits entiers) par séparation et évaluation.
+ *
+ * Les objets sont parcourus par ratio décroissant en profondeur d'abord ; la borne de
+ * Dantzig d'un nœud s'obtient en O(log n) par sommes préfixes. Si `node_limit` est
+ * atteint, la borne de Dantzig de la racine est retournée (toujours valide).
+ *
+ * @param profits Profits des n objets.
+ * @param weights Poids agrégés des n objets.
+ * @param n Nombre d'objets.
+ * @param capacity Capacité agrégée.
+ * @param node_limit Nombre maximal de nœuds explorés.
+ * @param x Reçoit la meilleure solution trouvée (n valeurs).
+ * @param exact Reçoit 1 si la recherche est allée à son terme, 0 sinon.
+ * @return La valeur optimale si `*exact`, sinon une borne supérieure de celle-ci.
+ */
+int surrogate_knapsack(const int *profits, const double *weights, int n, double capacity, long node_limit, int *x, int *exact);
+
+/**
+ * @brief Calcule la borne surrogate et les multiplicateurs associés.
+ *
+ * @param instance Instance du problème.
+ * @param iterations Nombre maximal d'ajustements des multiplicateurs.
+ * @param sr Résultat, alloué par la fonction (à libérer avec `surrogate_free`).
+ * @return 0 en cas de succès, -1 si la relaxation linéaire de départ a échoué.
+ */
+int surrogate_solve(const KnapsackInstance *instance, int iterations, SurrogateRelaxation *sr);
+
+/**
+ * @brief Libère les tableaux d'une relaxation surrogate.
+ *
+ * @param sr Relaxation à libérer.
+ */
+void surrogate_free(SurrogateRelaxation *sr);
+
+/**
+ * @brief Ordonne les objets par ratio p[i] / (w.W[.][i]) décroissant pour les multiplicateurs surrogate.
+ *
+ * @param instance Instance du problème.
+ * @param iterations Nombre maximal d'ajustements des multiplicateurs.
+ * @return Un tableau de `n` indices, à libérer avec `free` (ordre d'efficacité si le calcul échoue).
+ */
+int *surrogate_utility_order(const KnapsackInstance *instance, int iterations);
+
+#endif // SURROGATE_H
@@ -0,0 +1,59 @@
+#include "termination.h"
+#include "surrogate.h"
+#include <math.h>
+
+// Critère d'arrêt du thread courant
+static _Thread_local int target_value = 0;
+static _Thread_local TimeValue target_start;
+static _Thread_local double target_time = -1.0;
+
+void termination_set_target(int target)
+{
+    target_value = target > 0 ? target : 0;
+    target_start = get_current_time();
+    target_time = -1.0;
+}
+
+void termination_clear(void)
+{
+    target_value = 0;
+    target_time = -1.0;
+}
+
+int termination_target(void)
+{
+    return target_value;
+}
+
+int target_reached(int Z)
+{
+    if (target_value <= 0 || Z < target_value)
+    {
+        return 0;
+    }
+    if (target_time < 0)
+    {
+        target_time = get_elapsed_time(target_start, get_current_time());
+    }
+    return 1;
+}
+
+double time_to_target(void)
+{
+    return target_time;
+}
+
+int proven_optimality_target(const KnapsackInstance *instance)
+{
+    // Borne surrogate (au moins aussi bonne que la borne LP), sinon partie entière de la borne LP
+    SurrogateRelaxation sr;
+    int target = surrogate_solve(instance, 30, &sr) == 0 ? sr.bound : 0;
+    surrogate_free(&sr);
+    if (target <= 0)
+    {
+        // Tolérance pour une borne entière calculée en flottants
+        double bound = lp_upper_bound(instance);
+        target = bound > 0 ? (int)floor(bound + 1e-6) : 0;
+    }
+    return target;
+}
@@ -0,0 +1,58 @@
+#ifndef TERMINATION_H
+#define TERMINATION_H
+
+#include "knapsack.h"
+#include "chrono.h"
+
+/**
+ * @brief Fixe la valeur cible du thread courant : les métaheuristiques s'arrêtent dès que leur meilleure solution l'atteint.
+ *
+ * Le critère est propre à chaque thread, comme l'échéance de `check_timeout`. Le temps
+ * d'atteinte de la cible est mesuré à partir de cet appel.
+ *
+ * @param target Valeur cible (0 ou moins pour désactiver le critère).
+ */
+void termination_set_target(int target);
+
+/**
+ * @brief Désactive le critère d'arrêt du thread courant.
+ */
+void termination_clear(void);
+
+/**
+ * @brief Retourne la valeur cible du thread courant.
+ *
+ * @return La cible, ou 0 si le critère est désactivé.
+ */
+int termination_target(void);
+
+/**
+ * @brief Indique si une valeur atteint la cible du thread courant.
+ *
+ * Le premier appel qui atteint la cible enregistre le temps d'atteinte.
+ *
+ * @param Z Valeur de la meilleure solution courante.
+ * @return 1 si une cible est fixée et que `Z` l'atteint, 0 sinon.
+ */
+int target_reached(int Z);
+
+/**
+ * @brief Temps écoulé entre `termination_set_target` et la première atteinte de la cible.
+ *
+ * @return Le temps en secondes, ou -1 si la cible n'a pas été atteinte.
+ */
+double time_to_target(void);
+
+/**
+ * @brief Valeur à partir de laquelle une solution est prouvée optimale : la borne surrogate.
+ *
+ * Les profits étant entiers, une solution de valeur au moins égale à la partie entière
+ * d'une borne supérieure est optimale. La borne surrogate (`surrogate.h`) est utilisée,
+ * ou à défaut la partie entière de la borne LP.
+ *
+ * @param instance Instance du problème.
+ * @return La cible d'optimalité prouvée, ou 0 si la borne n'a pas pu être calculée.
+ */
+int proven_optimality_target(const KnapsackInstance *instance);
+
+#endif // TERMINATION_H
@@ -0,0 +1,338 @@
+#include "thread_pool.h"
+
+#define WORK_QUEUE_INITIAL_CAPACITY 64
+
+// Pool et indice du thread courant (NULL / -1 hors du pool)
+static _Thread_local ThreadPool *current_pool = NULL;
+static _Thread_local int current_index = -1;
+
+typedef struct {
+    ThreadPool *pool;
+    int index;
+} WorkerStart;
+
+// Lot d'indices partagé par thread_pool_parallel_for
+typedef struct {
+    void (*function)(void *arg, int index);
+    void *arg;
+    int count;
+    atomic_int next;
+    atomic_int done;
+    atomic_int refs;
+    pthread_mutex_t lock;
+    pthread_cond_t finished;
+} ParallelBatch;
+
+static void queue_push(WorkQueue *queue, PoolTask task)
+{
+    pthread_mutex_lock(&queue->lock);
+    if (queue->count == queue->capacity)
+    {
+        // Agrandir le tampon circulaire en le remettant à plat
+        int new_capacity = queue->capacity * 2;
+        PoolTask *tasks = (PoolTask *)malloc(new_capacity * sizeof(PoolTask));
+        if (!tasks)
+        {
+            perror("Erreur d'allocation mémoire pour la file de travail (queue_push)");
+            exit(EXIT_FAILURE);
+        }
+        for (int i = 0; i < queue->count; i++)
+        {
+            tasks[i] = queue->tasks[(queue->head + i) % queue->capacity];
+        }
+        free(queue->tasks);
+        queue->tasks = tasks;
+        queue->capacity = new_capacity;
+        queue->head = 0;
+    }
+    queue->tasks[(queue->head + queue->count) % queue->capacity] = task;
+    queue->count++;
+    pthread_mutex_unlock(&queue->lock);
+}
+
+// Le propriétaire dépile la tâche la plus récente
+static int queue_pop(WorkQueue *queue, PoolTask *task)
+{
+    int found = 0;
+    pthread_mutex_lock(&queue->lock);
+    if (queue->count > 0)
+    {
+        queue->count--;
+        *task = queue->tasks[(queue->head + queue->count) % queue->capacity];
+        found = 1;
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return found;
+}
+
+// Un voleur prend la tâche la plus ancienne
+static int queue_steal(WorkQueue *queue, PoolTask *task)
+{
+    int found = 0;
+    pthread_mutex_lock(&queue->lock);
+    if (queue->count > 0)
+    {
+        *task = queue->tasks[queue->head];
+        queue->head = (queue->head + 1) % queue->capacity;
+        queue->count--;
+        found = 1;
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return found;
+}
+
+static int find_task(ThreadPool *pool, int index, PoolTask *task)
+{
+    if (queue_pop(&pool->queues[index], task))
+    {
+        return 1;
+    }
+    for (int offset = 1; offset < pool->thread_count; offset++)
+    {
+        if (queue_steal(&pool->queues[(index + offset) % pool->thread_count], task))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void task_finished(ThreadPool *pool)
+{
+    if (atomic_fetch_sub(&pool->pending, 1) == 1)
+    {
+        pthread_mutex_lock(&pool->lock);
+        pthread_cond_broadcast(&pool->all_done);
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+static void *worker_run(void *arg)
+{
+    WorkerStart start = *(WorkerStart *)arg;
+    free(arg);
+    ThreadPool *pool = start.pool;
+    current_pool = pool;
+    current_index = start.index;
+
+    for (;;)
+    {
+        PoolTask task;
+        if (find_task(pool, start.index, &task))
+        {
+            atomic_fetch_sub(&pool->queued, 1);
+            task.function(task.arg);
+            task_finished(pool);
+            continue;
+        }
+
+        pthread_mutex_lock(&pool->lock);
+        while (atomic_load(&pool->queued) == 0 && !pool->shutdown)
+        {
+            pthread_cond_wait(&pool->work_available, &pool->lock);
+        }
+        int stop = pool->shutdown && atomic_load(&pool->queued) == 0;
+        pthread_mutex_unlock(&pool->lock);
+        if (stop)
+        {
+            break;
+        }
+    }
+    return NULL;
+}
+
+ThreadPool *thread_pool_create(int thread_count)
+{
+    if (thread_count < 1)
+    {
+        thread_count = 1;
+    }
+    ThreadPool *pool = (ThreadPool *)calloc(1, sizeof(ThreadPool));
+    if (!pool)
+    {
+        perror("Erreur d'allocation mémoire pour le pool (thread_pool_create)");
+        return NULL;
+    }
+    pool->thread_count = thread_count;
+    pool->threads = (pthread_t *)calloc(thread_count, sizeof(pthread_t));
+    pool->queues = (WorkQueue *)calloc(thread_count, sizeof(WorkQueue));
+    if (!pool->threads || !pool->queues)
+    {
+        perror("Erreur d'allocation mémoire pour le pool (thread_pool_create)");
+        free(pool->threads);
+        free(pool->queues);
+        free(pool);
+        return NULL;
+    }
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_available, NULL);
+    pthread_cond_init(&pool->all_done, NULL);
+    atomic_init(&pool->queued, 0);
+    atomic_init(&pool->pending, 0);
+    atomic_init(&pool->next_queue, 0);
+
+    for (int i = 0; i < thread_count; i++)
+    {
+        pthread_mutex_init(&pool->queues[i].lock, NULL);
+        pool->queues[i].capacity = WORK_QUEUE_INITIAL_CAPACITY;
+        pool->queues[i].tasks = (PoolTask *)malloc(WORK_QUEUE_INITIAL_CAPACITY * sizeof(PoolTask));
+        if (!pool->queues[i].tasks)
+        {
+            perror("Erreur d'allocation mémoire pour la file de travail (thread_pool_create)");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    for (int i = 0; i < thread_count; i++)
+    {
+        WorkerStart *start = (WorkerStart *)malloc(sizeof(WorkerStart));
+        if (!start)
+        {
+            perror("Erreur d'allocation mémoire pour un thread (thread_pool_create)");
+            exit(EXIT_FAILURE);
+        }
+        start->pool = pool;
+        start->index = i;
+        if (pthread_create(&pool->threads[i], NULL, worker_run, start) != 0)
+        {
+            perror("Erreur lors de la création d'un thread (thread_pool_create)");
+            exit(EXIT_FAILURE);
+        }
+    }
+    return pool;
+}
+
+void thread_pool_submit(ThreadPool *pool, TaskFunction function, void *arg)
+{
+    PoolTask task = {function, arg};
+    int index = (current_pool == pool) ? current_index : atomic_fetch_add(&pool->next_queue, 1) % pool->thread_count;
+
+    atomic_fetch_add(&pool->pending, 1);
+    atomic_fetch_add(&pool->queued, 1);
+    queue_push(&pool->queues[index], task);
+
+    pthread_mutex_lock(&pool->lock);
+    pthread_cond_signal(&pool->work_available);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void thread_pool_wait(ThreadPool *pool)
+{
+    pthread_mutex_lock(&pool->lock);
+    while (atomic_load(&pool->pending) > 0)
+    {
+        pthread_cond_wait(&pool->all_done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+static void batch_work(ParallelBatch *batch)
+{
+    int index;
+    while ((index = atomic_fetch_add(&batch->next, 1)) < batch->count)
+    {
+        batch->function(batch->arg, index);
+        if (atomic_fetch_add(&batch->done, 1) + 1 == batch->count)
+        {
+            pthread_mutex_lock(&batch->lock);
+            pthread_cond_broadcast(&batch->finished);
+            pthread_mutex_unlock(&batch->lock);
+        }
+    }
+}
+
+// Le dernier participant (appelant ou tâche d'aide) libère le lot
+static void batch_release(ParallelBatch *batch)
+{
+    if (atomic_fetch_sub(&batch->refs, 1) == 1)
+    {
+        pthread_mutex_destroy(&batch->lock);
+        pthread_cond_destroy(&batch->finished);
+        free(batch);
+    }
+}
+
+static void batch_task(void *arg)
+{
+    ParallelBatch *batch = (ParallelBatch *)arg;
+    batch_work(batch);
+    batch_release(batch);
+}
+
+void thread_pool_parallel_for(ThreadPool *pool, int count, void (*function)(void *arg, int index), void *arg)
+{
+    if (pool == NULL || count <= 1)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            function(arg, i);
+        }
+        return;
+    }
+
+    ParallelBatch *batch = (ParallelBatch *)malloc(sizeof(ParallelBatch));
+    if (!batch)
+    {
+        perror("Erreur d'allocation mémoire pour le lot (thread_pool_parallel_for)");
+        exit(EXIT_FAILURE);
+    }
+    int helpers = (pool->thread_count < count - 1) ? pool->thread_count : count - 1;
+    batch->function = function;
+    batch->arg = arg;
+    batch->count = count;
+    atomic_init(&batch->next, 0);
+    atomic_init(&batch->done, 0);
+    atomic_init(&batch->refs, helpers + 1);
+    pthread_mutex_init(&batch->lock, NULL);
+    pthread_cond_init(&batch->finished, NULL);
+
+    for (int i = 0; i < helpers; i++)
+    {
+        thread_pool_submit(pool, batch_task, batch);
+    }
+
+    // L'appelant participe, puis attend les indices encore en cours chez les autres
+    batch_work(batch);
+    pthread_mutex_lock(&batch->lock);
+    while (atomic_load(&batch->done) < count)
+    {
+        pthread_cond_wait(&batch->finished, &batch->lock);
+    }
+    pthread_mutex_unlock(&batch->lock);
+    batch_release(batch);
+}
+
+int thread_pool_current_worker(void)
+{
+    return current_index;
+}
+
+void thread_pool_destroy(ThreadPool *pool)
+{
+    if (pool == NULL)
+    {
+        return;
+    }
+    thread_pool_wait(pool);
+
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->work_available);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < pool->thread_count; i++)
+    {
+        pthread_join(pool->threads[i], NULL);
+    }
+    for (int i = 0; i < pool->thread_count; i++)
+    {
+        pthread_mutex_destroy(&pool->queues[i].lock);
+        free(pool->queues[i].tasks);
+    }
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->work_available);
+    pthread_cond_destroy(&pool->all_done);
+    free(pool->queues);
+    free(pool->threads);
+    free(pool);
+}
@@ -0,0 +1,110 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+/**
+ * @brief Fonction exécutée par une tâche du pool.
+ */
+typedef void (*TaskFunction)(void *arg);
+
+/**
+ * @brief Tâche en attente dans une file de travail.
+ */
+typedef struct {
+    TaskFunction function; ///< Fonction à exécuter.
+    void *arg;             ///< Argument passé à la fonction.
+} PoolTask;
+
+/**
+ * @brief File de travail d'un thread du pool (double file protégée par un verrou).
+ *
+ * Le propriétaire dépile par le bas (dernier entré, premier sorti, pour la localité),
+ * les voleurs prennent par le haut (les tâches les plus anciennes, souvent les plus grosses).
+ */
+typedef struct {
+    pthread_mutex_t lock; ///< Verrou de la file.
+    PoolTask *tasks;      ///< Tampon circulaire des tâches.
+    int capacity;         ///< Capacité du tampon.
+    int head;             ///< Indice de la plus ancienne tâche (côté vol).
+    int count;            ///< Nombre de tâches dans la file.
+} WorkQueue;
+
+/**
+ * @brief Pool de threads à vol de travail.
+ *
+ * Chaque thread possède sa propre file. Une tâche soumise depuis un thread du pool va
+ * dans la file de ce thread ; une tâche soumise depuis l'extérieur est répartie à tour
+ * de rôle. Un thread dont la file est vide vole des tâches dans les files des autres.
+ */
+typedef struct {
+    int thread_count;             ///< Nombre de threads du pool.
+    pthread_t *threads;           ///< Threads du pool.
+    WorkQueue *queues;            ///< Une file par thread.
+    pthread_mutex_t lock;         ///< Verrou des variables de condition.
+    pthread_cond_t work_available; ///< Signalée lorsqu'une tâche est soumise.
+    pthread_cond_t all_done;      ///< Signalée lorsque toutes les tâches sont terminées.
+    atomic_int queued;            ///< Tâches en file, pas encore démarrées.
+    atomic_int pending;           ///< Tâches soumises, pas encore terminées.
+    atomic_int next_queue;        ///< Prochaine file pour les soumissions extérieures.
+    int shutdown;                 ///< 1 lorsque le pool doit s'arrêter (protégé par lock).
+} ThreadPool;
+
+/**
+ * @brief Crée un pool de threads.
+ *
+ * @param thread_count Nombre de threads (au moins 1).
+ * @return Un pointeur vers le pool, ou `NULL` en cas d'erreur.
+ */
+ThreadPool *thread_pool_create(int thread_count);
+
+/**
+ * @brief Soumet une tâche au pool.
+ *
+ * @param pool Pool cible.
+ * @param function Fonction à exécuter.
+ * @param arg Argument passé à la fonction (doit rester valide jusqu'à la fin de la tâche).
+ */
+void thread_pool_submit(ThreadPool *pool, TaskFunction function, void *arg);
+
+/**
+ * @brief Attend que toutes les tâches soumises soient terminées.
+ *
+ * @param pool Pool concerné.
+ *
+ * @note Ne pas appeler depuis une tâche du pool (utiliser `thread_pool_parallel_for`).
+ */
+void thread_pool_wait(ThreadPool *pool);
+
+/**
+ * @brief Exécute `function(arg, i)` pour tout i dans [0, count[ en répartissant les indices sur le pool.
+ *
+ * Le thread appelant participe au calcul et ne rend la main que lorsque tous les indices
+ * sont traités. La fonction peut donc être appelée depuis une tâche du pool sans risque
+ * d'interblocage. Si `pool` vaut `NULL`, la boucle est exécutée séquentiellement.
+ *
+ * @param pool Pool à utiliser, ou `NULL`.
+ * @param count Nombre d'indices.
+ * @param function Fonction appelée pour chaque indice.
+ * @param arg Argument commun passé à chaque appel.
+ */
+void thread_pool_parallel_for(ThreadPool *pool, int count, void (*function)(void *arg, int index), void *arg);
+
+/**
+ * @brief Retourne l'indice du thread du pool qui exécute l'appelant.
+ *
+ * @return L'indice dans [0, thread_count[ si l'appelant est un thread de pool, -1 sinon.
+ */
+int thread_pool_current_worker(void);
+
+/**
+ * @brief Attend la fin des tâches, arrête les threads et libère le pool.
+ *
+ * @param pool Pool à détruire (peut être `NULL`).
+ */
+void thread_pool_destroy(ThreadPool *pool);
+
+#endif // THREAD_POOL_H